@@ -0,0 +1,102 @@
+// --- Utility Includes ---
+#include <cieutils/logging.hpp>
+#include "cieutils/packages/io/inc/json.hpp"
+#include "cmake_variables.hpp"
+
+// --- STL Includes ---
+#include <sstream>
+#include <filesystem>
+#include <vector>
+#include <utility>
+
+
+namespace cie {
+
+
+/// Mesh-like configuration with a large number of small items
+std::string makeConfiguration( Size numberOfElements )
+{
+    std::stringstream stream;
+    stream << R"({"name":"benchmark","version":2,"settings":{"tolerance":1e-10,"maxIterations":500,"solver":"cg"},"elements":[)";
+
+    for ( Size i=0; i<numberOfElements; ++i )
+    {
+        if ( i )
+            stream << ',';
+
+        stream << R"({"id":)" << i
+               << R"(,"material":"steel","active":)" << ( i % 3 ? "true" : "false" )
+               << R"(,"nodes":[)" << 4*i << ',' << 4*i + 1 << ',' << 4*i + 2 << ',' << 4*i + 3 << ']'
+               << R"(,"coordinates":[)" << 0.1 * i << ',' << 0.2 * i << ',' << 0.3 * i << "]}";
+    }
+
+    stream << "]}";
+    return stream.str();
+}
+
+
+int main()
+{
+    utils::Logger log( OUTPUT_PATH / "json_benchmark.log", true );
+
+    const Size numberOfElements = 2e5;
+    const Size numberOfLoads    = 5;
+
+    using Format = io::JSONObject::Format;
+
+    const std::vector<std::pair<Format,std::string>> formats = {
+        { Format::Text,         "json" },
+        { Format::CBOR,         "cbor" },
+        { Format::MessagePack,  "msgpack" },
+        { Format::UBJSON,       "ubjson" }
+    };
+
+    const io::JSONObject configuration( makeConfiguration(numberOfElements) );
+
+    log << "\x1b[38;2;0;255;0m";
+    {
+        auto localBlock = log.newBlock( "INFO" );
+        localBlock << "Number of elements: " + std::to_string( numberOfElements );
+        localBlock << "Number of loads   : " + std::to_string( numberOfLoads );
+
+        for ( const auto& [format, extension] : formats )
+        {
+            const auto filePath = OUTPUT_PATH / ( "json_benchmark." + extension );
+            configuration.write( filePath, format );
+            localBlock << extension + " file size: " + std::to_string( std::filesystem::file_size(filePath) ) + " [B]";
+        }
+    }
+    log << "\x1b[0m";
+
+    // Format detection included
+    for ( const auto& [format, extension] : formats )
+    {
+        const auto filePath = OUTPUT_PATH / ( "json_benchmark." + extension );
+        auto localBlock = log.newBlock( "load " + extension );
+
+        for ( Size i=0; i<numberOfLoads; ++i )
+            io::JSONObject json( filePath );
+    }
+
+    for ( const auto& [format, extension] : formats )
+    {
+        auto localBlock = log.newBlock( "save " + extension );
+
+        for ( Size i=0; i<numberOfLoads; ++i )
+            configuration.write( OUTPUT_PATH / ( "json_benchmark." + extension ), format );
+    }
+
+    return 0;
+}
+
+
+} // namespace cie
+
+
+
+
+int main()
+{
+    cie::main();
+    return 0;
+}
@@ -5,6 +5,11 @@
 #include <cieutils/logging.hpp>
 #include "cmake_variables.hpp"
 
+// --- STL Includes ---
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
 
 namespace cie {
 
@@ -24,6 +29,8 @@ using NodePtr        = std::shared_ptr<NodeType>;
 using SamplerType    = csg::CartesianGridSampler<PrimitiveType>;
 using SplitterType   = csg::WeightedSplitPolicy< NodeType::sample_point_iterator,
                                                  NodeType::value_iterator >;
+using BisectorType   = csg::MidPointSplitPolicy< NodeType::sample_point_iterator,
+                                                 NodeType::value_iterator >;
 
 
 // --- MAIN --- //
@@ -50,8 +57,23 @@ int main()
         return r_point[0]*r_point[0] + r_point[1]*r_point[1] + r_point[2]*r_point[2] - 1.0;
     };
 
+    // Same target, evaluated on all sample points of a cell at once
+    NodeType::batch_target_function batchTarget = []( const CoordinateType* p_coordinates,
+                                                      Size numberOfPoints,
+                                                      ValueType* p_values ) -> void
+    {
+        const CoordinateType* p_x = p_coordinates;
+        const CoordinateType* p_y = p_x + numberOfPoints;
+        const CoordinateType* p_z = p_y + numberOfPoints;
+
+        for ( Size i=0; i<numberOfPoints; ++i )
+            p_values[i] = p_x[i]*p_x[i] + p_y[i]*p_y[i] + p_z[i]*p_z[i] - 1.0;
+    };
+
+    auto p_sampler = NodeType::sampler_ptr( new SamplerType(numberOfPointsPerDimension) );
+
     auto p_root = NodePtr( new NodeType(
-        NodeType::sampler_ptr( new SamplerType(numberOfPointsPerDimension) ),
+        p_sampler,
         NodeType::split_policy_ptr( new SplitterType ),
         0,
         PointType { -2.0, -2.0, -2.0 },
@@ -64,6 +86,112 @@ int main()
             auto localBlock = log.newBlock( "divide" );
             p_root->divide( target, depth, pool );
         }
+
+        // Whole-tree passes
+        std::vector<const NodeType*> boundaryLeaves;
+        {
+            auto localBlock = log.newBlock( "collect boundary leaves" );
+            p_root->visit( [&boundaryLeaves]( NodeType* p_node ) -> bool
+            {
+                if ( p_node->isLeaf() && p_node->isBoundary() )
+                    boundaryLeaves.push_back( p_node );
+                return true;
+            } );
+        }
+
+        std::atomic<Size> numberOfBoundaryLeaves = 0;
+        {
+            auto localBlock = log.newBlock( "count boundary leaves (parallel)" );
+            p_root->visitParallel( [&numberOfBoundaryLeaves]( NodeType* p_node ) -> bool
+            {
+                if ( p_node->isLeaf() && p_node->isBoundary() )
+                    ++numberOfBoundaryLeaves;
+                return true;
+            }, pool, 3 );
+        }
+
+        log << "Number of boundary leaves: " + std::to_string( numberOfBoundaryLeaves.load() );
+
+        {
+            auto localBlock = log.newBlock( "divide (batch target)" );
+            p_root->divide( batchTarget, depth, pool );
+        }
+
+        // Children of bisected cells reuse the values of their parent and siblings
+        std::atomic<Size> numberOfEvaluations = 0;
+        NodeType::batch_target_function countingTarget = [&batchTarget, &numberOfEvaluations]( const CoordinateType* p_coordinates,
+                                                                                               Size numberOfPoints,
+                                                                                               ValueType* p_values ) -> void
+        {
+            numberOfEvaluations += numberOfPoints;
+            batchTarget( p_coordinates, numberOfPoints, p_values );
+        };
+
+        // Replaces the tree (boundaryLeaves is invalidated)
+        p_root->setSplitPolicy( NodeType::split_policy_ptr( new BisectorType ) );
+
+        {
+            auto localBlock = log.newBlock( "divide (midpoint splitting, batch target)" );
+            p_root->divide( countingTarget, depth, pool );
+        }
+
+        Size numberOfNodes = 0;
+        p_root->visit( [&numberOfNodes]( NodeType* ) -> bool { ++numberOfNodes; return true; } );
+
+        log << "Number of evaluations: " + std::to_string( numberOfEvaluations.load() )
+               + " (" + std::to_string( numberOfNodes * p_sampler->size() ) + " sample points)";
+
+        // Largest cut leaf: bounds the distance of the boundary from the captured cells
+        auto maxBoundaryExtent = [&p_root]() -> CoordinateType
+        {
+            CoordinateType extent = 0;
+            p_root->visit( [&extent]( NodeType* p_node ) -> bool
+            {
+                if ( p_node->isLeaf() && p_node->isBoundary() )
+                    extent = std::max( extent, p_node->lengths()[0] );
+                return true;
+            } );
+            return extent;
+        };
+
+        log << "Largest boundary leaf: " + std::to_string( maxBoundaryExtent() );
+
+        // Refine the largest cut cells first, with half the evaluations of the full subdivision
+        NodeType::refinement_cost budget;
+        budget.numberOfEvaluations = numberOfEvaluations / 2;
+        NodeType::refinement_cost cost;
+
+        {
+            auto localBlock = log.newBlock( "refine (half the evaluations, batch target)" );
+            cost = p_root->refine(
+                batchTarget,
+                depth,
+                NodeType::error_indicator_ptr( new csg::CellSizeErrorIndicator<NodeType::sample_point_iterator,NodeType::value_iterator> ),
+                budget
+            );
+        }
+
+        log << "Number of evaluations: " + std::to_string( cost.numberOfEvaluations )
+               + " (" + std::to_string( cost.numberOfNodes ) + " nodes)";
+        log << "Largest boundary leaf: " + std::to_string( maxBoundaryExtent() );
+
+        // Same subdivision as the midpoint divide, only the leaves are stored
+        using LinearTreeType = csg::LinearSpaceTree<Dimension,CoordinateType,ValueType>;
+        LinearTreeType linearTree( p_sampler, PointType { -2.0, -2.0, -2.0 }, PointType { 2.0, 2.0, 2.0 } );
+
+        {
+            auto localBlock = log.newBlock( "divide (linear tree)" );
+            linearTree.divide( target, depth, pool );
+        }
+
+        {
+            auto localBlock = log.newBlock( "divide (linear tree, batch target)" );
+            linearTree.divide( batchTarget, depth, pool );
+        }
+
+        log << "Number of leaves (linear tree): " + std::to_string( linearTree.size() )
+               + " (" + std::to_string( linearTree.size() * (sizeof(LinearTreeType::key_type) + sizeof(LinearTreeType::flag_type)) ) + " [B])";
+
         pool.terminate();
     }
 
@@ -5,6 +5,7 @@
 
 // --- STL Includes ---
 #include <functional>
+#include <atomic>
 #include <iostream>
 
 
@@ -44,14 +45,34 @@ int main()
     }
 
     {
-        mp::ThreadPool pool;
-        auto localBlock = log.newBlock( "ThreadPool - job queue" );
+        mp::ThreadPool pool( mp::ThreadPool::maxNumberOfThreads(), mp::ThreadPool::Scheduling::Shared );
+        auto localBlock = log.newBlock( "ThreadPool - shared job queue" );
 
         for ( unsigned int i=0; i<numberOfJobs; ++i )
             pool.queueJob( std::bind(&crappyFibonacci, fibonacciIndex) );
         pool.terminate();
     }
 
+    {
+        mp::ThreadPool pool( mp::ThreadPool::maxNumberOfThreads(), mp::ThreadPool::Scheduling::WorkStealing );
+        auto localBlock = log.newBlock( "ThreadPool - work stealing" );
+
+        for ( unsigned int i=0; i<numberOfJobs; ++i )
+            pool.queueJob( std::bind(&crappyFibonacci, fibonacciIndex) );
+        pool.terminate();
+    }
+
+    {
+        // Near-empty jobs: measures the queueing overhead
+        mp::ThreadPool pool;
+        std::atomic<unsigned int> counter = 0;
+        auto localBlock = log.newBlock( "ThreadPool - fine-grained jobs" );
+
+        for ( unsigned int i=0; i<numberOfJobs; ++i )
+            pool.queueJob( [&pool, &counter, i]() { counter += i % pool.size(); } );
+        pool.terminate();
+    }
+
     {
         auto localBlock = log.newBlock( "ThreadPool - parallel for" );
 
@@ -61,6 +82,15 @@ int main()
         );
     }
 
+    {
+        auto localBlock = log.newBlock( "ThreadPool - parallel for (dynamic)" );
+
+        mp::ParallelFor<>().setSchedule( mp::LoopSchedule::Dynamic, 64 )(
+            0, numberOfJobs, 1,
+            [fibonacciIndex]( Size ){ crappyFibonacci(fibonacciIndex); }
+        );
+    }
+
     #ifdef _OPENMP
     #pragma omp parallel
     {
@@ -13,6 +13,11 @@ else()
     set( CIE_ENABLE_OPENMP ON CACHE BOOL "enable openmp directives" )
 endif()
 
+set( CIE_ENABLE_THREAD_POOL_STATISTICS OFF CACHE BOOL "Collect per-thread utilization counters in thread pools" )
+if( ${CIE_ENABLE_THREAD_POOL_STATISTICS} )
+    add_compile_definitions( CIE_ENABLE_THREAD_POOL_STATISTICS )
+endif()
+
 # ---------------------------------------------------------
 # OPENGL OPTIONS
 # ---------------------------------------------------------
@@ -26,12 +31,18 @@ if ( ${CIE_ENABLE_EXCEPTION_TRACING} )
     add_compile_definitions( CIE_ENABLE_EXCEPTION_TRACING )
 endif()
 
+# 0: CIE_CHECK only, 1: + division by zero and geometry checks, 2: + out of range checks
+set( CIE_CHECK_LEVEL 2 CACHE STRING "Highest level of enabled runtime checks (0-2)" )
+set_property( CACHE CIE_CHECK_LEVEL PROPERTY STRINGS 0 1 2 )
+add_compile_definitions( CIE_CHECK_LEVEL=${CIE_CHECK_LEVEL} )
+
 set( CIE_ENABLE_OUT_OF_RANGE_TESTS ON CACHE BOOL "" )
 if( ${CIE_ENABLE_OUT_OF_RANGE_TESTS} )
     add_compile_definitions( CIE_ENABLE_OUT_OF_RANGE_TESTS )
 endif()
 
-set( CIE_ENABLE_DIVISION_BY_ZERO_CHECKS ON CACHE BOOL "" )
+# Off by default: the checks used to be compiled out, and they branch in vector arithmetic
+set( CIE_ENABLE_DIVISION_BY_ZERO_CHECKS OFF CACHE BOOL "" )
 if( ${CIE_ENABLE_DIVISION_BY_ZERO_CHECKS} )
     add_compile_definitions( CIE_ENABLE_DIVISION_BY_ZERO_CHECKS )
 endif()
@@ -2,12 +2,16 @@
 #define CIE_CSG_TREES_EXTERNAL_HPP
 
 #include "CSG/packages/trees/inc/SpaceTreeNode.hpp"
+#include "CSG/packages/trees/inc/LinearSpaceTree.hpp"
 
 #include "CSG/packages/trees/inc/SplitPolicy.hpp"
 #include "CSG/packages/trees/inc/MidPointSplitPolicy.hpp"
 #include "CSG/packages/trees/inc/LinearSplitPolicy.hpp"
 #include "CSG/packages/trees/inc/WeightedSplitPolicy.hpp"
 
+#include "CSG/packages/trees/inc/ErrorIndicator.hpp"
+#include "CSG/packages/trees/inc/CellSizeErrorIndicator.hpp"
+
 #include "CSG/packages/trees/inc/PrimitiveSampler.hpp"
 #include "CSG/packages/trees/inc/CartesianGridSampler.hpp"
 
@@ -25,6 +25,15 @@ AbsCartesianGridSampler<PrimitiveType>::size() const
 }
 
 
+template <concepts::Primitive PrimitiveType>
+inline Size
+AbsCartesianGridSampler<PrimitiveType>::nestedGridSize() const
+{
+    // A single point is in the center
+    return this->_numberOfPointsPerDimension < 2 ? 0 : this->_numberOfPointsPerDimension;
+}
+
+
 template <concepts::Primitive PrimitiveType>
 inline Size
 AbsCartesianGridSampler<PrimitiveType>::numberOfPointsPerDimension() const
@@ -98,6 +107,35 @@ CartesianGridSampler<PrimitiveType>::getSamplePoint( const PrimitiveType& r_prim
 }
 
 
+template <concepts::Cube PrimitiveType>
+inline void
+CartesianGridSampler<PrimitiveType>::getSamplePoints( const PrimitiveType& r_primitive,
+                                                      typename PrimitiveType::coordinate_type* p_coordinates ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    using CoordinateType = typename CartesianGridSampler<PrimitiveType>::coordinate_type;
+
+    const auto& r_base = r_primitive.base();
+    const CoordinateType length = r_primitive.length();
+    const Size numberOfPointsPerDimension = this->numberOfPointsPerDimension();
+
+    // Same arithmetic as getSamplePoint
+    this->indexConverter().fillGrid(
+        [&r_base, length, numberOfPointsPerDimension]( Size dim, Size index ) -> CoordinateType
+        {
+            if ( numberOfPointsPerDimension == 1 )
+                return r_base[dim] + length / CoordinateType(2);
+            else
+                return r_base[dim] + index * length / (CoordinateType(numberOfPointsPerDimension)-1.0);
+        },
+        p_coordinates
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
 
 /* --- Box sampler --- */
 
@@ -138,6 +176,35 @@ CartesianGridSampler<PrimitiveType>::getSamplePoint( const PrimitiveType& r_prim
 }
 
 
+template <concepts::Box PrimitiveType>
+inline void
+CartesianGridSampler<PrimitiveType>::getSamplePoints( const PrimitiveType& r_primitive,
+                                                      typename PrimitiveType::coordinate_type* p_coordinates ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    using CoordinateType = typename CartesianGridSampler<PrimitiveType>::coordinate_type;
+
+    const auto& r_base    = r_primitive.base();
+    const auto& r_lengths = r_primitive.lengths();
+    const Size numberOfPointsPerDimension = this->numberOfPointsPerDimension();
+
+    // Same arithmetic as getSamplePoint
+    this->indexConverter().fillGrid(
+        [&r_base, &r_lengths, numberOfPointsPerDimension]( Size dim, Size index ) -> CoordinateType
+        {
+            if ( numberOfPointsPerDimension == 1 )
+                return r_base[dim] + r_lengths[dim] / CoordinateType(2);
+            else
+                return r_base[dim] + index * r_lengths[dim] / (CoordinateType(numberOfPointsPerDimension)-1.0);
+        },
+        p_coordinates
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
 } // namespace cie::csg
 
 
@@ -10,6 +10,7 @@
 
 // --- STL Includes ---
 #include <iterator>
+#include <algorithm>
 
 
 namespace cie::csg {
@@ -36,6 +37,32 @@ CartesianIndexConverter<Dimension>::convert( Size index ) const
 }
 
 
+template <Size Dimension>
+template <class CoordinateType, class AxisFunction>
+inline void
+CartesianIndexConverter<Dimension>::fillGrid( AxisFunction&& r_axisCoordinate,
+                                              CoordinateType* p_coordinates ) const
+{
+    const Size numberOfPointsPerDimension = _numberOfPointsPerDimension;
+
+    // The first index varies fastest => component 'dim' is constant
+    // over runs of numberOfPointsPerDimension^dim points
+    Size stride = 1;
+    for ( Size dim=0; dim<Dimension; ++dim, stride*=numberOfPointsPerDimension )
+    {
+        CoordinateType* p_component = p_coordinates + dim * _numberOfPoints;
+
+        for ( Size i_axis=0; i_axis<numberOfPointsPerDimension; ++i_axis )
+        {
+            const CoordinateType coordinate = r_axisCoordinate( dim, i_axis );
+
+            for ( Size i_block=i_axis*stride; i_block<_numberOfPoints; i_block+=stride*numberOfPointsPerDimension )
+                std::fill_n( p_component + i_block, stride, coordinate );
+        }
+    }
+}
+
+
 template <Size Dimension>
 inline Size
 CartesianIndexConverter<Dimension>::numberOfPointsPerDimension() const
@@ -0,0 +1,55 @@
+#ifndef CIE_CSG_TREES_CELL_SIZE_ERROR_INDICATOR_IMPL_HPP
+#define CIE_CSG_TREES_CELL_SIZE_ERROR_INDICATOR_IMPL_HPP
+
+// --- STL Includes ---
+#include <algorithm>
+
+
+namespace cie::csg {
+
+
+template <  concepts::IteratorType PointIterator,
+            concepts::IteratorType ValueIterator >
+inline Double
+CellSizeErrorIndicator<PointIterator,ValueIterator>::operator()(
+            ValueIterator it_valueBegin,
+            ValueIterator it_valueEnd,
+            PointIterator it_pointBegin ) const
+{
+    using PointType = typename PointIterator::value_type;
+
+    if ( it_valueBegin == it_valueEnd )
+        return 0.0;
+
+    const bool isFirstValuePositive = *it_valueBegin > 0;
+    bool isBoundary = false;
+
+    PointType lower = *it_pointBegin;
+    PointType upper = lower;
+
+    for ( ; it_valueBegin!=it_valueEnd; ++it_valueBegin,++it_pointBegin )
+    {
+        isBoundary |= ( (*it_valueBegin > 0) != isFirstValuePositive );
+
+        const auto& r_point = *it_pointBegin;
+        for ( Size dim=0; dim<r_point.size(); ++dim )
+        {
+            lower[dim] = std::min( lower[dim], r_point[dim] );
+            upper[dim] = std::max( upper[dim], r_point[dim] );
+        }
+    }
+
+    if ( !isBoundary )
+        return 0.0;
+
+    Double extent = 0.0;
+    for ( Size dim=0; dim<lower.size(); ++dim )
+        extent = std::max( extent, Double(upper[dim] - lower[dim]) );
+
+    return extent;
+}
+
+
+} // namespace cie::csg
+
+#endif
\ No newline at end of file
@@ -23,6 +23,14 @@ CornerSampler<PrimitiveType>::size() const
 }
 
 
+template <concepts::Cube PrimitiveType>
+inline Size
+CornerSampler<PrimitiveType>::nestedGridSize() const
+{
+    return 2;
+}
+
+
 template <concepts::Cube PrimitiveType>
 typename PrimitiveType::point_type
 CornerSampler<PrimitiveType>::getSamplePoint( const PrimitiveType& r_primitive,
@@ -44,6 +52,25 @@ CornerSampler<PrimitiveType>::getSamplePoint( const PrimitiveType& r_primitive,
 }
 
 
+template <concepts::Cube PrimitiveType>
+void
+CornerSampler<PrimitiveType>::getSamplePoints( const PrimitiveType& r_primitive,
+                                               typename PrimitiveType::coordinate_type* p_coordinates ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto& r_base = r_primitive.base();
+    const auto length  = r_primitive.length();
+
+    this->_p_indexConverter->fillGrid(
+        [&r_base, length]( Size dim, Size index ) { return r_base[dim] + index * length; },
+        p_coordinates
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
 template <concepts::Box PrimitiveType>
 CornerSampler<PrimitiveType>::CornerSampler() :
     _p_indexConverter( new CartesianIndexConverter<PrimitiveType::dimension>(2) )
@@ -59,6 +86,14 @@ CornerSampler<PrimitiveType>::size() const
 }
 
 
+template <concepts::Box PrimitiveType>
+inline Size
+CornerSampler<PrimitiveType>::nestedGridSize() const
+{
+    return 2;
+}
+
+
 template <concepts::Box PrimitiveType>
 typename PrimitiveType::point_type
 CornerSampler<PrimitiveType>::getSamplePoint( const PrimitiveType& r_primitive,
@@ -81,6 +116,25 @@ CornerSampler<PrimitiveType>::getSamplePoint( const PrimitiveType& r_primitive,
 }
 
 
+template <concepts::Box PrimitiveType>
+void
+CornerSampler<PrimitiveType>::getSamplePoints( const PrimitiveType& r_primitive,
+                                               typename PrimitiveType::coordinate_type* p_coordinates ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto& r_base    = r_primitive.base();
+    const auto& r_lengths = r_primitive.lengths();
+
+    this->_p_indexConverter->fillGrid(
+        [&r_base, &r_lengths]( Size dim, Size index ) { return r_base[dim] + index * r_lengths[dim]; },
+        p_coordinates
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
 } // namespace cie::csg
 
 
@@ -0,0 +1,613 @@
+#ifndef CIE_CSG_LINEAR_SPACE_TREE_IMPL_HPP
+#define CIE_CSG_LINEAR_SPACE_TREE_IMPL_HPP
+
+// --- Utility Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+#include "cieutils/packages/macros/inc/checks.hpp"
+
+// --- STL Includes ---
+#include <algorithm>
+#include <type_traits>
+#include <memory>
+#include <cmath>
+#include <bit>
+#include <string>
+
+
+namespace cie::csg {
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::LinearSpaceTree( typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::sampler_ptr p_sampler,
+                                                                      const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::point_type& r_base,
+                                                                      const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::point_type& r_lengths ) :
+    _p_sampler( p_sampler ),
+    _root( r_base, r_lengths ),
+    _keys( 1, key_type(1) ),
+    _flags()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK_POINTER( _p_sampler )
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::divide( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::target_function& r_target,
+                                                             Size level )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->divide_internal( r_target, level, mp::ThreadPoolSingleton::get() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::divide( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::target_function& r_target,
+                                                             Size level,
+                                                             mp::ThreadPool& r_threadPool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->divide_internal( r_target, level, r_threadPool );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::divide( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::batch_target_function& r_target,
+                                                             Size level )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->divide_internal( r_target, level, mp::ThreadPoolSingleton::get() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::divide( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::batch_target_function& r_target,
+                                                             Size level,
+                                                             mp::ThreadPool& r_threadPool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->divide_internal( r_target, level, r_threadPool );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::evaluate( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::target_function& r_target )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->evaluate_internal( r_target, mp::ThreadPoolSingleton::get() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::evaluate( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::target_function& r_target,
+                                                               mp::ThreadPool& r_threadPool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->evaluate_internal( r_target, r_threadPool );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::evaluate( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::batch_target_function& r_target )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->evaluate_internal( r_target, mp::ThreadPoolSingleton::get() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::evaluate( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::batch_target_function& r_target,
+                                                               mp::ThreadPool& r_threadPool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->evaluate_internal( r_target, r_threadPool );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline Size
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::size() const
+{
+    return _keys.size();
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::key( Size leafIndex ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( leafIndex < this->size() )
+    return _keys[leafIndex];
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline Size
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::level( Size leafIndex ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( leafIndex < this->size() )
+    return levelOf( _keys[leafIndex] );
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::isBoundary( Size leafIndex ) const
+{
+    if ( _flags.empty() )
+        CIE_THROW( std::runtime_error, "LinearSpaceTree::isBoundary expects the tree to be evaluated" )
+
+    CIE_OUT_OF_RANGE_CHECK( leafIndex < this->size() )
+    return _flags[leafIndex] != 0;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::primitive_type
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::cell( Size leafIndex ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_OUT_OF_RANGE_CHECK( leafIndex < this->size() )
+
+    primitive_type cell;
+    this->getCell( _keys[leafIndex], cell );
+    return cell;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+Size
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::find( const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::point_type& r_point ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Cell of the deepest level that contains the point
+    const key_type numberOfCells = key_type(1) << maxLevel;
+    std::array<key_type,Dimension> coordinates;
+
+    for ( Size dim=0; dim<Dimension; ++dim )
+    {
+        const CoordinateType relative = (r_point[dim] - _root.base()[dim]) / _root.lengths()[dim];
+
+        if ( !(0 <= relative && relative <= 1) )
+            return npos;
+
+        coordinates[dim] = std::min( key_type(relative * numberOfCells), numberOfCells - 1 );
+    }
+
+    return this->findKey( this->encode(coordinates, maxLevel) );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+Size
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::findNeighbor( Size leafIndex,
+                                                                   Size dimension,
+                                                                   bool isPositiveDirection ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_OUT_OF_RANGE_CHECK( leafIndex < this->size() )
+    CIE_OUT_OF_RANGE_CHECK( dimension < Dimension )
+
+    // Cell of the deepest level adjacent to the lower corner of the face
+    const key_type key  = _keys[leafIndex];
+    const Size shift    = maxLevel - levelOf( key );
+    auto coordinates    = this->decode( key );
+
+    for ( auto& r_coordinate : coordinates )
+        r_coordinate <<= shift;
+
+    if ( isPositiveDirection )
+    {
+        coordinates[dimension] += key_type(1) << shift;
+        if ( coordinates[dimension] == (key_type(1) << maxLevel) )
+            return npos;
+    }
+    else
+    {
+        if ( coordinates[dimension] == 0 )
+            return npos;
+        --coordinates[dimension];
+    }
+
+    return this->findKey( this->encode(coordinates, maxLevel) );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline const std::vector<typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type>&
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::keys() const
+{
+    return _keys;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline const std::vector<typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::flag_type>&
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::boundaryFlags() const
+{
+    return _flags;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::primitive_type&
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::root() const
+{
+    return _root;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline const typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::sampler_ptr&
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::sampler() const
+{
+    return _p_sampler;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline Size
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::levelOf( typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type key )
+{
+    return (std::bit_width(key) - 1) / Dimension;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+template <class TargetType>
+bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::divide_internal( const TargetType& r_target,
+                                                                      Size level,
+                                                                      mp::ThreadPool& r_pool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK(
+        level <= maxLevel,
+        "Level " + std::to_string(level) + " exceeds the maximum level of the keys (" + std::to_string(maxLevel) + ")"
+    )
+
+    std::vector<key_type> keys;
+    std::vector<flag_type> flags;
+
+    this->divideCell( r_target, key_type(1), level, r_pool, keys, flags );
+
+    _keys  = std::move( keys );
+    _flags = std::move( flags );
+
+    return 1 < _keys.size();
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+template <class TargetType>
+void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::divideCell( const TargetType& r_target,
+                                                                 typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type key,
+                                                                 Size level,
+                                                                 mp::ThreadPool& r_pool,
+                                                                 std::vector<typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type>& r_keys,
+                                                                 std::vector<typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::flag_type>& r_flags ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const Size keyLevel   = levelOf( key );
+    const bool isBoundary = this->evaluateCell( r_target, key );
+
+    if ( !isBoundary || level <= keyLevel )
+    {
+        r_keys.push_back( key );
+        r_flags.push_back( isBoundary ? 1 : 0 );
+        return;
+    }
+
+    constexpr Size numberOfChildren = Size(1) << Dimension;
+    const key_type firstChild       = key << Dimension;
+
+    // Subtrees on the top levels are divided in separate jobs (up to 2^12),
+    // their leaves are collected in separate containers and appended in order
+    if ( (keyLevel + 1) * Dimension <= 12 )
+    {
+        std::array<std::vector<key_type>,numberOfChildren> childKeys;
+        std::array<std::vector<flag_type>,numberOfChildren> childFlags;
+
+        std::vector<mp::JobHandle<void>> handles;
+        handles.reserve( numberOfChildren );
+
+        for ( Size i_child=0; i_child<numberOfChildren; ++i_child )
+            handles.push_back( r_pool.submit(
+                [this, &r_target, &r_pool, &childKeys, &childFlags, firstChild, level, i_child]() -> void
+                { this->divideCell( r_target, firstChild | i_child, level, r_pool, childKeys[i_child], childFlags[i_child] ); }
+            ) );
+
+        r_pool.waitFor( handles );
+
+        for ( const auto& r_handle : handles )
+            r_handle.get();
+
+        for ( Size i_child=0; i_child<numberOfChildren; ++i_child )
+        {
+            r_keys.insert( r_keys.end(), childKeys[i_child].begin(), childKeys[i_child].end() );
+            r_flags.insert( r_flags.end(), childFlags[i_child].begin(), childFlags[i_child].end() );
+        }
+    }
+    else
+        for ( Size i_child=0; i_child<numberOfChildren; ++i_child )
+            this->divideCell( r_target, firstChild | i_child, level, r_pool, r_keys, r_flags );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+template <class TargetType>
+void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::evaluate_internal( const TargetType& r_target,
+                                                                        mp::ThreadPool& r_pool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    _flags.resize( _keys.size() );
+
+    // Contiguous blocks of leaves, a few per thread
+    const Size numberOfBlocks = std::min( _keys.size(), 4 * std::max(r_pool.size(), Size(1)) );
+    const Size blockSize      = (_keys.size() + numberOfBlocks - 1) / numberOfBlocks;
+
+    std::vector<mp::JobHandle<void>> handles;
+    handles.reserve( numberOfBlocks );
+
+    for ( Size begin=0; begin<_keys.size(); begin+=blockSize )
+        handles.push_back( r_pool.submit(
+            [this, &r_target, begin, blockSize]() -> void
+            {
+                const Size end = std::min( begin + blockSize, _keys.size() );
+                for ( Size i_leaf=begin; i_leaf<end; ++i_leaf )
+                    _flags[i_leaf] = this->evaluateCell( r_target, _keys[i_leaf] ) ? 1 : 0;
+            }
+        ) );
+
+    r_pool.waitFor( handles );
+
+    for ( const auto& r_handle : handles )
+        r_handle.get();
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+template <class TargetType>
+inline bool
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::evaluateCell( const TargetType& r_target,
+                                                                   typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type key ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Buffers are reused by all cells evaluated on the same thread
+    static thread_local primitive_type cell;
+    this->getCell( key, cell );
+
+    const Size numberOfPoints = _p_sampler->size();
+
+    if constexpr ( std::is_same_v<TargetType,batch_target_function> )
+    {
+        static thread_local std::vector<CoordinateType> coordinates;
+        static thread_local std::unique_ptr<ValueType[]> p_values; // contiguous even if ValueType is bool
+        static thread_local Size capacity = 0;
+
+        coordinates.resize( Dimension * numberOfPoints );
+        if ( capacity < numberOfPoints )
+        {
+            p_values.reset( new ValueType[numberOfPoints] );
+            capacity = numberOfPoints;
+        }
+
+        _p_sampler->getSamplePoints( cell, coordinates.data() );
+        r_target( coordinates.data(), numberOfPoints, p_values.get() );
+
+        const bool isFirstValuePositive = p_values[0] > 0;
+        bool isBoundary = false;
+
+        for ( Size i_point=1; i_point<numberOfPoints; ++i_point )
+            isBoundary |= ( (p_values[i_point] > 0) != isFirstValuePositive );
+
+        return isBoundary;
+    }
+    else
+    {
+        // Values are not stored => stop at the first sign change
+        const bool isFirstValuePositive = r_target( _p_sampler->getSamplePoint(cell, 0) ) > 0;
+
+        for ( Size i_point=1; i_point<numberOfPoints; ++i_point )
+            if ( (r_target( _p_sampler->getSamplePoint(cell, i_point) ) > 0) != isFirstValuePositive )
+                return true;
+
+        return false;
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline void
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::getCell( typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type key,
+                                                              typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::primitive_type& r_cell ) const
+{
+    const Size keyLevel     = levelOf( key );
+    const auto coordinates  = this->decode( key );
+
+    for ( Size dim=0; dim<Dimension; ++dim )
+    {
+        const CoordinateType length = std::ldexp( _root.lengths()[dim], -int(keyLevel) );
+        r_cell.base()[dim]    = _root.base()[dim] + coordinates[dim] * length;
+        r_cell.lengths()[dim] = length;
+    }
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline std::array<typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type,Dimension>
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::decode( typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type key ) const
+{
+    std::array<key_type,Dimension> coordinates;
+    coordinates.fill( 0 );
+
+    // Child indices from the root down
+    for ( Size i_level=levelOf(key); 0<i_level; --i_level )
+    {
+        const key_type childIndex = key >> (Dimension * (i_level-1));
+        for ( Size dim=0; dim<Dimension; ++dim )
+            coordinates[dim] = (coordinates[dim] << 1) | ((childIndex >> dim) & 1);
+    }
+
+    return coordinates;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::encode( const std::array<typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type,Dimension>& r_coordinates,
+                                                             Size level ) const
+{
+    key_type key = 1;
+
+    for ( Size i_level=level; 0<i_level; --i_level )
+    {
+        key <<= Dimension;
+        for ( Size dim=0; dim<Dimension; ++dim )
+            key |= ((r_coordinates[dim] >> (i_level-1)) & 1) << dim;
+    }
+
+    return key;
+}
+
+
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+inline Size
+LinearSpaceTree<Dimension,CoordinateType,ValueType>::findKey( typename LinearSpaceTree<Dimension,CoordinateType,ValueType>::key_type key ) const
+{
+    // Keys extended to the deepest level (by appending zeros) have the same
+    // length, and the leaves cover disjoint key ranges in increasing order
+    auto extend = []( key_type key ) -> key_type
+    { return key << (Dimension * (maxLevel - levelOf(key))); };
+
+    const key_type extendedKey = extend( key );
+
+    auto it_leaf = std::upper_bound(
+        _keys.begin(),
+        _keys.end(),
+        extendedKey,
+        [&extend]( key_type left, key_type right ) { return left < extend(right); }
+    );
+
+    return std::distance( _keys.begin(), it_leaf ) - 1;
+}
+
+
+} // namespace cie::csg
+
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef CIE_CSG_PRIMITIVE_SAMPLER_IMPL_HPP
+#define CIE_CSG_PRIMITIVE_SAMPLER_IMPL_HPP
+
+// --- Utility Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+
+namespace cie::csg {
+
+
+template <concepts::Primitive PrimitiveType>
+void
+PrimitiveSampler<PrimitiveType>::getSamplePoints( const PrimitiveType& r_primitive,
+                                                  typename PrimitiveType::coordinate_type* p_coordinates ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const Size numberOfPoints = this->size();
+
+    for ( Size i_point=0; i_point<numberOfPoints; ++i_point )
+    {
+        const auto point = this->getSamplePoint( r_primitive, i_point );
+        for ( Size dim=0; dim<PrimitiveType::dimension; ++dim )
+            p_coordinates[dim*numberOfPoints + i_point] = point[dim];
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::Primitive PrimitiveType>
+inline Size
+PrimitiveSampler<PrimitiveType>::nestedGridSize() const
+{
+    return 0;
+}
+
+
+} // namespace cie::csg
+
+#endif
\ No newline at end of file
@@ -3,14 +3,21 @@
 
 // --- Utility Includes ---
 #include "cieutils/packages/macros/inc/exceptions.hpp"
-#include "cieutils/packages/stl_extension/inc/resize.hpp"
 #include "cieutils/packages/stl_extension/inc/make_shared_from_tuple.hpp"
+#include "cieutils/packages/maths/inc/power.hpp"
 
 // --- Internal Includes ---
 #include "cmake_variables.hpp"
 
 // --- STL Includes ---
 #include <tuple>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+#include <cstdint>
+#include <queue>
 
 
 namespace cie::csg {
@@ -23,15 +30,82 @@ SpaceTreeNode<CellType,ValueType>::SpaceTreeNode(   typename SpaceTreeNode<CellT
                                                     typename SpaceTreeNode<CellType,ValueType>::split_policy_ptr p_splitPolicy,
                                                     Size level,
                                                     Args&&... args ) :
+    SpaceTreeNode<CellType,ValueType>(
+        makeSharedData( p_sampler, p_splitPolicy, nullptr ),
+        level,
+        std::forward<Args>(args)...
+    )
+{
+}
+
+
+template <  class CellType,
+            class ValueType >
+template <class ...Args>
+SpaceTreeNode<CellType,ValueType>::SpaceTreeNode(   typename SpaceTreeNode<CellType,ValueType>::shared_data_ptr p_sharedData,
+                                                    Size level,
+                                                    Args&&... args ) :
     CellType( std::forward<Args>(args)... ),
     utils::AbsTree<std::vector,SpaceTreeNode<CellType,ValueType>>( level ),
-    _p_splitPolicy( p_splitPolicy ),
-    _p_sampler( p_sampler ),
+    _p_sharedData( p_sharedData ),
+    _p_values( nullptr ),
     _isBoundary(-1)
 {
 }
 
 
+template <  class CellType,
+            class ValueType >
+SpaceTreeNode<CellType,ValueType>::SpaceTreeNode( const SpaceTreeNode<CellType,ValueType>& r_rhs ) :
+    CellType( r_rhs ),
+    utils::AbsTree<std::vector,SpaceTreeNode<CellType,ValueType>>( r_rhs ),
+    _p_sharedData( r_rhs._p_sharedData ),
+    _p_values( nullptr ),
+    _isBoundary( r_rhs._isBoundary )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( r_rhs._p_values )
+        std::copy_n( r_rhs._p_values, this->sampler()->size(), this->allocateValues() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+SpaceTreeNode<CellType,ValueType>&
+SpaceTreeNode<CellType,ValueType>::operator=( const SpaceTreeNode<CellType,ValueType>& r_rhs )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( this != &r_rhs )
+    {
+        CellType::operator=( r_rhs );
+        utils::AbsTree<std::vector,SpaceTreeNode<CellType,ValueType>>::operator=( r_rhs );
+
+        this->releaseValues();
+        _p_sharedData = r_rhs._p_sharedData;
+        _isBoundary   = r_rhs._isBoundary;
+
+        if ( r_rhs._p_values )
+            std::copy_n( r_rhs._p_values, this->sampler()->size(), this->allocateValues() );
+    }
+
+    return *this;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+SpaceTreeNode<CellType,ValueType>::~SpaceTreeNode()
+{
+    this->releaseValues();
+}
+
+
 template <  class CellType,
             class ValueType >
 inline bool
@@ -40,15 +114,11 @@ SpaceTreeNode<CellType,ValueType>::divide(  const typename SpaceTreeNode<CellTyp
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    mp::ThreadPool pool;
-    bool result = this->divide(
+    return this->divide(
         r_target,
         level,
-        pool
+        mp::ThreadPoolSingleton::get()
     );
-    pool.terminate();
-
-    return result;
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -63,14 +133,48 @@ SpaceTreeNode<CellType,ValueType>::divide( const typename SpaceTreeNode<CellType
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    bool result = this->divide_internal(
+    return this->divide_internal(
         r_target,
         level,
         r_threadPool
     );
-    r_threadPool.barrier();
 
-    return result;
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+inline bool
+SpaceTreeNode<CellType,ValueType>::divide(  const typename SpaceTreeNode<CellType,ValueType>::batch_target_function& r_target,
+                                            Size level )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->divide(
+        r_target,
+        level,
+        mp::ThreadPoolSingleton::get()
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+inline bool
+SpaceTreeNode<CellType,ValueType>::divide( const typename SpaceTreeNode<CellType,ValueType>::batch_target_function& r_target,
+                                           Size level,
+                                           mp::ThreadPool& r_threadPool )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->divide_internal(
+        r_target,
+        level,
+        r_threadPool
+    );
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -104,14 +208,14 @@ SpaceTreeNode<CellType,ValueType>::divide(  const typename SpaceTreeNode<CellTyp
     // Split if boundary
     if ( _isBoundary == 1 )
     {
-        auto splitPoint = _p_splitPolicy->operator()(
-            _values.begin(),
-            _values.end(),
+        const auto values = this->values();
+        auto splitPoint = this->splitPolicy()->operator()(
+            values.begin(),
+            values.end(),
             typename SpaceTreeNode<CellType,ValueType>::sample_point_iterator(0,*this)
         );
 
-        auto nodeConstructor    = std::make_tuple(  _p_sampler,
-                                                    _p_splitPolicy,
+        auto nodeConstructor    = std::make_tuple(  _p_sharedData,
                                                     this->_level + 1 );
         auto p_cellConstructors = this->split( splitPoint );
 
@@ -153,8 +257,7 @@ SpaceTreeNode<CellType,ValueType>::evaluate( const typename SpaceTreeNode<CellTy
 
     // Init
     _isBoundary = -1;
-    cie::utils::resize( _values, _p_sampler->size() );
-    auto it_value = _values.begin();
+    ValueType* it_value = this->allocateValues();
     typename SpaceTreeNode<CellType,ValueType>::sample_point_iterator it_point(0,*this);
 
     // Evaluate first point separately and set sign flag
@@ -162,7 +265,7 @@ SpaceTreeNode<CellType,ValueType>::evaluate( const typename SpaceTreeNode<CellTy
     bool isFirstValuePositive = *it_value > 0;
     it_value++;
 
-    auto it_valueEnd = _values.end();
+    ValueType* it_valueEnd = _p_values + this->sampler()->size();
 
     // Evaluate the rest of the points
     for ( ; it_value!=it_valueEnd; ++it_value,++it_point )
@@ -183,6 +286,192 @@ SpaceTreeNode<CellType,ValueType>::evaluate( const typename SpaceTreeNode<CellTy
 
 
 
+template <  class CellType,
+            class ValueType >
+inline void
+SpaceTreeNode<CellType,ValueType>::evaluate( const typename SpaceTreeNode<CellType,ValueType>::batch_target_function& r_target )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    using CoordinateType = typename CellType::coordinate_type;
+
+    // Init
+    _isBoundary = -1;
+    const Size numberOfPoints = this->sampler()->size();
+
+    // Buffer is reused by all cells evaluated on the same thread
+    static thread_local std::vector<CoordinateType> coordinates;
+    coordinates.resize( CellType::dimension * numberOfPoints );
+
+    this->sampler()->getSamplePoints( *this, coordinates.data() );
+    r_target( coordinates.data(), numberOfPoints, this->allocateValues() );
+
+    this->updateBoundaryFlag();
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+
+template <  class CellType,
+            class ValueType >
+template <class TargetType>
+inline bool
+SpaceTreeNode<CellType,ValueType>::evaluateChildren( const TargetType& r_target )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    using CoordinateType = typename CellType::coordinate_type;
+    constexpr Size Dimension = CellType::dimension;
+
+    const auto& rp_sampler                = this->sampler();
+    const Size numberOfPointsPerDimension = rp_sampler->nestedGridSize();
+    const Size numberOfPoints             = rp_sampler->size();
+
+    if ( numberOfPointsPerDimension < 2 || this->_children.empty() || !_p_values )
+        return false;
+
+    // Grid point 'i' of this node is lattice point 2i along each dimension,
+    // grid point 'i' of a child is lattice point i (lower half) or i + numberOfPointsPerDimension - 1
+    const Size latticeSize = 2*numberOfPointsPerDimension - 1;
+
+    // Locate the children on the lattice using the corners of the grids
+    // (the split point need not be the exact center, so compare with a tolerance)
+    const auto lower = rp_sampler->getSamplePoint( *this, 0 );
+    const auto upper = rp_sampler->getSamplePoint( *this, numberOfPoints-1 );
+
+    std::vector<Size> childOffsets;
+    childOffsets.reserve( this->_children.size() );
+
+    for ( const auto& p_child : this->_children )
+    {
+        const auto childLower = rp_sampler->getSamplePoint( *p_child, 0 );
+        const auto childUpper = rp_sampler->getSamplePoint( *p_child, numberOfPoints-1 );
+
+        Size offset = 0;
+        Size stride = 1;
+
+        for ( Size dim=0; dim<Dimension; ++dim, stride*=latticeSize )
+        {
+            const CoordinateType center    = (lower[dim] + upper[dim]) / 2;
+            const CoordinateType tolerance = 1e-8 * (upper[dim] - lower[dim]);
+
+            if ( std::abs(childLower[dim] - lower[dim]) <= tolerance && std::abs(childUpper[dim] - center) <= tolerance )
+                continue;
+            else if ( std::abs(childLower[dim] - center) <= tolerance && std::abs(childUpper[dim] - upper[dim]) <= tolerance )
+                offset += (numberOfPointsPerDimension-1) * stride;
+            else
+                return false;
+        }
+
+        childOffsets.push_back( offset );
+    }
+
+    // Lattice indices of a lower child's grid points (this node's are twice as large)
+    std::vector<Size> gridIndices( numberOfPoints );
+    for ( Size i_point=0; i_point<numberOfPoints; ++i_point )
+    {
+        Size index  = i_point;
+        Size stride = 1;
+
+        for ( Size dim=0; dim<Dimension; ++dim, stride*=latticeSize )
+        {
+            gridIndices[i_point] += (index % numberOfPointsPerDimension) * stride;
+            index /= numberOfPointsPerDimension;
+        }
+    }
+
+    const Size numberOfLatticePoints = intPow( latticeSize, Dimension );
+    std::vector<ValueType> latticeValues( numberOfLatticePoints );
+    std::vector<std::uint8_t> isKnown( numberOfLatticePoints, 0 );
+
+    for ( Size i_point=0; i_point<numberOfPoints; ++i_point )
+    {
+        latticeValues[2*gridIndices[i_point]] = _p_values[i_point];
+        isKnown[2*gridIndices[i_point]]       = 1;
+    }
+
+    if constexpr ( std::is_same_v<TargetType,typename SpaceTreeNode<CellType,ValueType>::batch_target_function> )
+    {
+        // Collect the missing points of all children, and evaluate them in one call
+        const Size childStride = Dimension * numberOfPoints;
+        std::vector<CoordinateType> childCoordinates( this->_children.size() * childStride );
+        std::vector<Size> missingIndices, missingSources;
+
+        for ( Size i_child=0; i_child<this->_children.size(); ++i_child )
+        {
+            rp_sampler->getSamplePoints( *this->_children[i_child], childCoordinates.data() + i_child*childStride );
+
+            for ( Size i_point=0; i_point<numberOfPoints; ++i_point )
+            {
+                const Size latticeIndex = childOffsets[i_child] + gridIndices[i_point];
+                if ( !isKnown[latticeIndex] )
+                {
+                    isKnown[latticeIndex] = 1;
+                    missingIndices.push_back( latticeIndex );
+                    missingSources.push_back( i_child*childStride + i_point );
+                }
+            }
+        }
+
+        const Size numberOfMissingPoints = missingIndices.size();
+
+        if ( numberOfMissingPoints )
+        {
+            std::vector<CoordinateType> coordinates( Dimension * numberOfMissingPoints );
+            for ( Size dim=0; dim<Dimension; ++dim )
+                for ( Size i_point=0; i_point<numberOfMissingPoints; ++i_point )
+                    coordinates[dim*numberOfMissingPoints + i_point] = childCoordinates[missingSources[i_point] + dim*numberOfPoints];
+
+            // Contiguous even if ValueType is bool
+            std::unique_ptr<ValueType[]> p_values( new ValueType[numberOfMissingPoints] );
+            r_target( coordinates.data(), numberOfMissingPoints, p_values.get() );
+
+            for ( Size i_point=0; i_point<numberOfMissingPoints; ++i_point )
+                latticeValues[missingIndices[i_point]] = p_values[i_point];
+        }
+
+        for ( Size i_child=0; i_child<this->_children.size(); ++i_child )
+        {
+            auto& r_child = *this->_children[i_child];
+            ValueType* p_childValues = r_child.allocateValues();
+
+            for ( Size i_point=0; i_point<numberOfPoints; ++i_point )
+                p_childValues[i_point] = latticeValues[childOffsets[i_child] + gridIndices[i_point]];
+
+            r_child.updateBoundaryFlag();
+        }
+    }
+    else
+    {
+        for ( Size i_child=0; i_child<this->_children.size(); ++i_child )
+        {
+            auto& r_child = *this->_children[i_child];
+            ValueType* p_childValues = r_child.allocateValues();
+
+            for ( Size i_point=0; i_point<numberOfPoints; ++i_point )
+            {
+                const Size latticeIndex = childOffsets[i_child] + gridIndices[i_point];
+                if ( !isKnown[latticeIndex] )
+                {
+                    latticeValues[latticeIndex] = r_target( rp_sampler->getSamplePoint(r_child, i_point) );
+                    isKnown[latticeIndex]       = 1;
+                }
+
+                p_childValues[i_point] = latticeValues[latticeIndex];
+            }
+
+            r_child.updateBoundaryFlag();
+        }
+    }
+
+    return true;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+
 template <  class CellType,
             class ValueType >
 inline typename SpaceTreeNode<CellType,ValueType>::target_map_ptr
@@ -195,45 +484,24 @@ SpaceTreeNode<CellType,ValueType>::evaluateMap( const TargetFunction<typename Ce
 
     // Init
     _isBoundary = -1;
-    cie::utils::resize( _values, _p_sampler->size() );
-    auto it_value = _values.begin();
+    ValueType* it_value = this->allocateValues();
     typename SpaceTreeNode<CellType,ValueType>::sample_point_iterator it_point(0,*this);
 
     // Evaluate first point separately and set sign flag
-    auto p_point      = &*it_point;
-    auto it_targetMap = p_targetMap->find( *p_point );
-
-    if ( it_targetMap == p_targetMap->end() )
-    {
-        it_targetMap = p_targetMap->emplace(
-            *p_point,
-            r_target( *p_point )
-        ).first;
-    }
-
-    *it_value = it_targetMap->second;
+    auto p_point = &*it_point;
+    *it_value    = p_targetMap->getOrInsert( *p_point, [&r_target, p_point]() { return r_target(*p_point); } );
     bool isFirstValuePositive = *it_value > 0;
 
     it_point++;
     it_value++;
 
-    auto it_valueEnd = _values.end();
+    ValueType* it_valueEnd = _p_values + this->sampler()->size();
 
     // Evaluate the rest of the points
     for ( ; it_value!=it_valueEnd; ++it_value,++it_point )
     {
-        p_point      = &*it_point;
-        it_targetMap = p_targetMap->find( *p_point );
-
-        if ( it_targetMap == p_targetMap->end() )
-        {
-            it_targetMap = p_targetMap->emplace(
-                *p_point,
-                r_target( *p_point )
-            ).first;
-        }
-
-        *it_value = it_targetMap->second;
+        p_point   = &*it_point;
+        *it_value = p_targetMap->getOrInsert( *p_point, [&r_target, p_point]() { return r_target(*p_point); } );
 
         // Boundary check
         if ( ((*it_value>0) != isFirstValuePositive) && (_isBoundary < 0)  )
@@ -257,7 +525,7 @@ inline void
 SpaceTreeNode<CellType,ValueType>::clear()
 {
     // Clear data
-    _values.clear();
+    this->releaseValues();
     for ( auto& p_child : this->_children )
         p_child->clear();
     
@@ -267,6 +535,23 @@ SpaceTreeNode<CellType,ValueType>::clear()
 
 
 
+template <  class CellType,
+            class ValueType >
+inline void
+SpaceTreeNode<CellType,ValueType>::updateBoundaryFlag()
+{
+    // Boundary check (without early exit, so it can be vectorized)
+    const bool isFirstValuePositive = _p_values[0] > 0;
+    bool isBoundary = false;
+
+    for ( const auto value : this->values() )
+        isBoundary |= ( (value > 0) != isFirstValuePositive );
+
+    _isBoundary = isBoundary ? 1 : 0;
+}
+
+
+
 template <  class CellType,
             class ValueType >
 inline bool
@@ -285,7 +570,8 @@ template <  class CellType,
 inline void
 SpaceTreeNode<CellType,ValueType>::setSplitPolicy( typename SpaceTreeNode<CellType,ValueType>::split_policy_ptr p_splitPolicy )
 {
-    _p_splitPolicy = p_splitPolicy;
+    // Other nodes may share the current data => replace instead of modifying it
+    _p_sharedData = makeSharedData( this->sampler(), p_splitPolicy, _p_sharedData->p_valueStore );
     this->_children.clear();
 }
 
@@ -296,9 +582,9 @@ template <  class CellType,
 inline void
 SpaceTreeNode<CellType,ValueType>::setSampler( typename SpaceTreeNode<CellType,ValueType>::sampler_ptr p_sampler )
 {
-    // Set pointer
-    _p_sampler = p_sampler;
-    _values.clear();
+    // The number of sample points may change => new value store
+    this->releaseValues();
+    _p_sharedData = makeSharedData( p_sampler, this->splitPolicy(), nullptr );
 
     // Reset flags
     _isBoundary = -1;
@@ -311,17 +597,17 @@ template <  class CellType,
 inline const typename SpaceTreeNode<CellType,ValueType>::split_policy_ptr&
 SpaceTreeNode<CellType,ValueType>::splitPolicy() const
 {
-    return _p_splitPolicy;
+    return _p_sharedData->p_splitPolicy;
 }
 
 
 
 template <  class CellType,
             class ValueType >
-inline const typename SpaceTreeNode<CellType,ValueType>::value_container_type&
+inline typename SpaceTreeNode<CellType,ValueType>::value_container_type
 SpaceTreeNode<CellType,ValueType>::values() const
 {
-    return _values;
+    return value_container_type( _p_values, _p_values ? this->sampler()->size() : 0 );
 }
 
 
@@ -331,16 +617,266 @@ template <  class CellType,
 inline const typename SpaceTreeNode<CellType,ValueType>::sampler_ptr&
 SpaceTreeNode<CellType,ValueType>::sampler() const
 {
-    return _p_sampler;
+    return _p_sharedData->p_sampler;
+}
+
+
+
+template <  class CellType,
+            class ValueType >
+inline const typename SpaceTreeNode<CellType,ValueType>::value_store_ptr&
+SpaceTreeNode<CellType,ValueType>::valueStore() const
+{
+    return _p_sharedData->p_valueStore;
+}
+
+
+
+template <  class CellType,
+            class ValueType >
+inline ValueType*
+SpaceTreeNode<CellType,ValueType>::allocateValues()
+{
+    if ( !_p_values )
+        _p_values = _p_sharedData->p_valueStore->allocate();
+
+    return _p_values;
+}
+
+
+
+template <  class CellType,
+            class ValueType >
+inline void
+SpaceTreeNode<CellType,ValueType>::releaseValues()
+{
+    _p_sharedData->p_valueStore->release( _p_values );
+    _p_values = nullptr;
+}
+
+
+
+template <  class CellType,
+            class ValueType >
+inline typename SpaceTreeNode<CellType,ValueType>::shared_data_ptr
+SpaceTreeNode<CellType,ValueType>::makeSharedData( typename SpaceTreeNode<CellType,ValueType>::sampler_ptr p_sampler,
+                                                   typename SpaceTreeNode<CellType,ValueType>::split_policy_ptr p_splitPolicy,
+                                                   typename SpaceTreeNode<CellType,ValueType>::value_store_ptr p_valueStore )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK_POINTER( p_sampler )
+
+    if ( !p_valueStore )
+        p_valueStore = std::make_shared<ValueStore<ValueType>>( p_sampler->size() );
+
+    return std::make_shared<shared_data>( shared_data { p_sampler, p_splitPolicy, p_valueStore } );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+inline typename SpaceTreeNode<CellType,ValueType>::refinement_cost
+SpaceTreeNode<CellType,ValueType>::refine( const typename SpaceTreeNode<CellType,ValueType>::target_function& r_target,
+                                           Size level,
+                                           typename SpaceTreeNode<CellType,ValueType>::error_indicator_ptr p_errorIndicator,
+                                           const typename SpaceTreeNode<CellType,ValueType>::refinement_cost& r_budget )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->refine_internal(
+        r_target,
+        level,
+        p_errorIndicator,
+        r_budget
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+inline typename SpaceTreeNode<CellType,ValueType>::refinement_cost
+SpaceTreeNode<CellType,ValueType>::refine( const typename SpaceTreeNode<CellType,ValueType>::batch_target_function& r_target,
+                                           Size level,
+                                           typename SpaceTreeNode<CellType,ValueType>::error_indicator_ptr p_errorIndicator,
+                                           const typename SpaceTreeNode<CellType,ValueType>::refinement_cost& r_budget )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->refine_internal(
+        r_target,
+        level,
+        p_errorIndicator,
+        r_budget
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+template <class TargetType>
+typename SpaceTreeNode<CellType,ValueType>::refinement_cost
+SpaceTreeNode<CellType,ValueType>::refine_internal( const TargetType& r_target,
+                                                    Size level,
+                                                    const typename SpaceTreeNode<CellType,ValueType>::error_indicator_ptr& rp_errorIndicator,
+                                                    const typename SpaceTreeNode<CellType,ValueType>::refinement_cost& r_budget )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK_POINTER( rp_errorIndicator )
+
+    const Size numberOfPoints = this->sampler()->size();
+
+    CIE_CHECK(
+        1 <= r_budget.numberOfNodes && numberOfPoints <= r_budget.numberOfEvaluations,
+        "The refinement budget does not cover the evaluation of the root"
+    )
+
+    refinement_cost cost { 1, 0 };
+
+    // Count evaluations in a wrapper, because shared sample points are not evaluated
+    TargetType target;
+    if constexpr ( std::is_same_v<TargetType,typename SpaceTreeNode<CellType,ValueType>::batch_target_function> )
+        target = [&r_target, &cost]( const typename CellType::coordinate_type* p_coordinates, Size size, ValueType* p_values ) -> void
+        {
+            cost.numberOfEvaluations += size;
+            r_target( p_coordinates, size, p_values );
+        };
+    else
+        target = [&r_target, &cost]( const typename CellType::point_type& r_point ) -> ValueType
+        {
+            ++cost.numberOfEvaluations;
+            return r_target( r_point );
+        };
+
+    // Worst leaf first, leaves with equal errors in creation order
+    using QueueItem = std::tuple<Double,Size,SpaceTreeNode<CellType,ValueType>*>;
+    auto compare = []( const QueueItem& r_lhs, const QueueItem& r_rhs ) -> bool
+    {
+        return std::get<0>(r_lhs) < std::get<0>(r_rhs)
+               || ( std::get<0>(r_lhs) == std::get<0>(r_rhs) && std::get<1>(r_rhs) < std::get<1>(r_lhs) );
+    };
+
+    std::priority_queue<QueueItem,std::vector<QueueItem>,decltype(compare)> queue( compare );
+    Size counter = 0;
+
+    auto push = [&queue, &counter, &rp_errorIndicator, level]( SpaceTreeNode<CellType,ValueType>* p_node ) -> void
+    {
+        if ( p_node->_level < level )
+        {
+            const Double error = p_node->error( rp_errorIndicator );
+            if ( 0 < error )
+                queue.emplace( error, counter++, p_node );
+        }
+    };
+
+    this->_children.clear();
+    this->evaluate( target );
+    push( this );
+
+    while ( !queue.empty() )
+    {
+        auto p_node = std::get<2>( queue.top() );
+        queue.pop();
+
+        p_node->makeChildren();
+        const Size numberOfChildren = p_node->_children.size();
+
+        // Stop if the split could exceed the budget
+        if ( r_budget.numberOfNodes - cost.numberOfNodes < numberOfChildren
+             || (r_budget.numberOfEvaluations - cost.numberOfEvaluations) / numberOfPoints < numberOfChildren )
+        {
+            p_node->_children.clear();
+            break;
+        }
+
+        if ( !p_node->evaluateChildren(target) )
+            for ( auto& rp_child : p_node->_children )
+                rp_child->evaluate( target );
+
+        cost.numberOfNodes += numberOfChildren;
+
+        for ( auto& rp_child : p_node->_children )
+            push( rp_child.get() );
+    }
+
+    return cost;
+
+    CIE_END_EXCEPTION_TRACING
 }
 
 
 template <  class CellType,
             class ValueType >
+inline void
+SpaceTreeNode<CellType,ValueType>::makeChildren()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->_children.clear();
+
+    const auto values = this->values();
+    auto splitPoint = this->splitPolicy()->operator()(
+        values.begin(),
+        values.end(),
+        typename SpaceTreeNode<CellType,ValueType>::sample_point_iterator(0,*this)
+    );
+
+    auto nodeConstructor    = std::make_tuple(  _p_sharedData,
+                                                this->_level + 1 );
+    auto p_cellConstructors = this->split( splitPoint );
+
+    for ( const auto& cellConstructor : *p_cellConstructors )
+    {
+        // Construct a child
+        auto compoundConstructor = std::tuple_cat(nodeConstructor,cellConstructor);
+        auto p_node = utils::make_shared_from_tuple<SpaceTreeNode<CellType,ValueType>>(compoundConstructor);
+
+        // Check whether child is valid
+        if ( p_node->isDegenerate() )
+            continue;
+
+        this->_children.push_back(p_node);
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+inline Double
+SpaceTreeNode<CellType,ValueType>::error( const typename SpaceTreeNode<CellType,ValueType>::error_indicator_ptr& rp_errorIndicator ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto values = this->values();
+    CIE_CHECK( !values.empty(), "SpaceTreeNode::error expects the node to be evaluated" )
+
+    return rp_errorIndicator->operator()(
+        values.begin(),
+        values.end(),
+        typename SpaceTreeNode<CellType,ValueType>::sample_point_iterator(0,*this)
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class CellType,
+            class ValueType >
+template <class TargetType>
 inline bool
-SpaceTreeNode<CellType,ValueType>::divide_internal( const typename SpaceTreeNode<CellType,ValueType>::target_function& r_target,
+SpaceTreeNode<CellType,ValueType>::divide_internal( const TargetType& r_target,
                                                     Size level,
-                                                    mp::ThreadPool& r_pool )
+                                                    mp::ThreadPool& r_pool,
+                                                    bool isEvaluated )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
@@ -348,7 +884,8 @@ SpaceTreeNode<CellType,ValueType>::divide_internal( const typename SpaceTreeNode
     this->_children.clear();
 
     // Evaluate target and set boundary flag
-    evaluate( r_target );
+    if ( !isEvaluated )
+        evaluate( r_target );
 
     // Do nothing if this is the last level
     if ( this->_level >= level )
@@ -357,34 +894,29 @@ SpaceTreeNode<CellType,ValueType>::divide_internal( const typename SpaceTreeNode
     // Split if boundary
     if ( this->_isBoundary == 1 )
     {
-        auto splitPoint = _p_splitPolicy->operator()(
-            _values.begin(),
-            _values.end(),
-            typename SpaceTreeNode<CellType,ValueType>::sample_point_iterator(0,*this)
-        );
+        this->makeChildren();
 
-        auto nodeConstructor    = std::make_tuple(  _p_sampler,
-                                                    _p_splitPolicy,
-                                                    this->_level + 1 );
-        auto p_cellConstructors = this->split( splitPoint );
+        // Reuse shared sample points if possible
+        const bool areChildrenEvaluated = this->evaluateChildren( r_target );
 
-        for ( const auto& cellConstructor : *p_cellConstructors )
+        std::vector<mp::JobHandle<bool>> handles;
+        handles.reserve( this->_children.size() );
+
+        for ( const auto& p_node : this->_children )
         {
-            // Construct a child
-            auto compoundConstructor = std::tuple_cat(nodeConstructor,cellConstructor);
-            auto p_node = utils::make_shared_from_tuple<SpaceTreeNode<CellType,ValueType>>(compoundConstructor);
-            
-            // Check whether child is valid
-            if ( p_node->isDegenerate() )
-                continue;
+            // Schedule divide on child (the target outlives the job, it is waited for below)
+            handles.push_back( r_pool.submit(
+                [p_node,&r_target,&r_pool,level,areChildrenEvaluated]() -> bool
+                { return p_node->divide_internal(r_target, level, r_pool, areChildrenEvaluated); }
+            ) );
+        }
 
-            this->_children.push_back(p_node);
+        // Wait only for the subtree of this node, so the pool can be shared
+        // with unrelated jobs (and divide can be called from within jobs)
+        r_pool.waitFor( handles );
 
-            // Schedule divide on child
-            r_pool.queueJob( [p_node,r_target,&r_pool,level]() -> void
-                { p_node->divide_internal(r_target, level, r_pool); }
-            );
-        }
+        for ( const auto& r_handle : handles )
+            r_handle.get();
 
         return true;
     }
@@ -0,0 +1,179 @@
+#ifndef CIE_CSG_VALUE_STORE_IMPL_HPP
+#define CIE_CSG_VALUE_STORE_IMPL_HPP
+
+// --- Utility Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+#include "cieutils/packages/macros/inc/checks.hpp"
+
+
+namespace cie::csg {
+
+
+template <class ValueType>
+ValueStore<ValueType>::ValueStore( Size sliceSize,
+                                   Size blockSize,
+                                   Size numberOfShards ) :
+    _sliceSize( sliceSize ),
+    _blockSize( blockSize ),
+    _shards()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK( 0 < sliceSize, "Empty slices" )
+    CIE_CHECK( 0 < blockSize, "Empty blocks" )
+
+    Size size = 1;
+    while ( size < numberOfShards )
+        size <<= 1;
+
+    _shards.reserve( size );
+    for ( Size i=0; i<size; ++i )
+    {
+        _shards.emplace_back( new Shard );
+        _shards.back()->numberOfCutSlices = blockSize;
+        _shards.back()->size = 0;
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+ValueType*
+ValueStore<ValueType>::allocate()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Shard& r_shard = this->shard();
+
+    {
+        std::scoped_lock<std::mutex> lock( r_shard.mutex );
+        if ( !r_shard.freeSlices.empty() || r_shard.numberOfCutSlices < _blockSize )
+            return this->allocate( r_shard );
+    }
+
+    // The shard is exhausted: take the slices released on other shards
+    // before cutting a new block (only one shard is locked at a time)
+    std::vector<ValueType*> stolenSlices;
+    for ( auto& rp_shard : _shards )
+    {
+        if ( rp_shard.get() == &r_shard )
+            continue;
+
+        std::scoped_lock<std::mutex> lock( rp_shard->mutex );
+        if ( !rp_shard->freeSlices.empty() )
+        {
+            stolenSlices.swap( rp_shard->freeSlices );
+            break;
+        }
+    }
+
+    std::scoped_lock<std::mutex> lock( r_shard.mutex );
+    r_shard.freeSlices.insert( r_shard.freeSlices.end(), stolenSlices.begin(), stolenSlices.end() );
+    return this->allocate( r_shard );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+ValueType*
+ValueStore<ValueType>::allocate( Shard& r_shard )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    ++r_shard.size;
+
+    if ( !r_shard.freeSlices.empty() )
+    {
+        ValueType* p_slice = r_shard.freeSlices.back();
+        r_shard.freeSlices.pop_back();
+        return p_slice;
+    }
+
+    if ( r_shard.numberOfCutSlices == _blockSize )
+    {
+        r_shard.blocks.emplace_back( new ValueType[_sliceSize * _blockSize] );
+        r_shard.numberOfCutSlices = 0;
+    }
+
+    return r_shard.blocks.back().get() + _sliceSize * r_shard.numberOfCutSlices++;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+void
+ValueStore<ValueType>::release( ValueType* p_slice )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // The slice goes to the shard of the releasing thread
+    if ( p_slice )
+    {
+        Shard& r_shard = this->shard();
+        std::scoped_lock<std::mutex> lock( r_shard.mutex );
+        r_shard.freeSlices.push_back( p_slice );
+        --r_shard.size;
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+inline Size
+ValueStore<ValueType>::sliceSize() const
+{
+    return _sliceSize;
+}
+
+
+template <class ValueType>
+inline Size
+ValueStore<ValueType>::size() const
+{
+    Size size = 0;
+    for ( const auto& rp_shard : _shards )
+    {
+        std::scoped_lock<std::mutex> lock( rp_shard->mutex );
+        size += rp_shard->size;
+    }
+    return size;
+}
+
+
+template <class ValueType>
+inline Size
+ValueStore<ValueType>::capacity() const
+{
+    Size numberOfBlocks = 0;
+    for ( const auto& rp_shard : _shards )
+    {
+        std::scoped_lock<std::mutex> lock( rp_shard->mutex );
+        numberOfBlocks += rp_shard->blocks.size();
+    }
+    return numberOfBlocks * _blockSize;
+}
+
+
+template <class ValueType>
+inline Size
+ValueStore<ValueType>::numberOfShards() const
+{
+    return _shards.size();
+}
+
+
+template <class ValueType>
+inline typename ValueStore<ValueType>::Shard&
+ValueStore<ValueType>::shard() const
+{
+    return *_shards[detail::valueStoreThreadIndex() & (_shards.size() - 1)];
+}
+
+
+} // namespace cie::csg
+
+#endif
\ No newline at end of file
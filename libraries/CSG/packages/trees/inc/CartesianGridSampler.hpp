@@ -21,6 +21,7 @@ public:
     AbsCartesianGridSampler( Size numberOfPointsPerDimension );
 
     virtual Size size() const override;
+    virtual Size nestedGridSize() const override;
     Size numberOfPointsPerDimension() const;
     void setNumberOfPointsPerDimension( Size numberOfPointsPerDimension );
 
@@ -50,6 +51,9 @@ public:
 
     virtual point_type getSamplePoint( const PrimitiveType& r_primitive,
                                        Size index ) const override;
+
+    virtual void getSamplePoints( const PrimitiveType& r_primitive,
+                                  typename PrimitiveType::coordinate_type* p_coordinates ) const override;
 };
 
 
@@ -65,6 +69,9 @@ public:
 
     virtual point_type getSamplePoint( const PrimitiveType& r_primitive,
                                        Size index ) const override;
+
+    virtual void getSamplePoints( const PrimitiveType& r_primitive,
+                                  typename PrimitiveType::coordinate_type* p_coordinates ) const override;
 };
 
 
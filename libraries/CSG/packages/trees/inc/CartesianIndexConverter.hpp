@@ -6,6 +6,7 @@
 
 // --- STL Includes ---
 #include <vector>
+#include <array>
 #include <memory>
 
 
@@ -30,6 +31,17 @@ public:
     //bool increment( UIntArray<Dimension>& r_index ) const;
     //bool decrement( UIntArray<Dimension>& r_index ) const;
 
+    /**
+     * Write the coordinates of all grid points in structure-of-arrays layout:
+     * component 'i' of point 'j' goes to p_coordinates[i*numberOfPoints() + j],
+     * points are in the order defined by convert.
+     * @param r_axisCoordinate CoordinateType(Size dimension, Size index) - coordinate
+     * of the index-th grid line along the specified dimension
+    */
+    template <class CoordinateType, class AxisFunction>
+    void fillGrid( AxisFunction&& r_axisCoordinate,
+                   CoordinateType* p_coordinates ) const;
+
     Size numberOfPointsPerDimension() const;
     Size numberOfPoints() const;
 
@@ -0,0 +1,32 @@
+#ifndef CIE_CSG_TREES_CELL_SIZE_ERROR_INDICATOR_HPP
+#define CIE_CSG_TREES_CELL_SIZE_ERROR_INDICATOR_HPP
+
+// --- Internal Includes ---
+#include "CSG/packages/trees/inc/ErrorIndicator.hpp"
+
+
+namespace cie::csg {
+
+
+/**
+ * Largest extent of the sample points' bounding box if the values
+ * have mixed signs, 0 otherwise. Bounds the distance between the
+ * boundary and the cut cells, so refining by this indicator
+ * reduces the worst boundary error first.
+*/
+template <  concepts::IteratorType PointIterator,
+            concepts::IteratorType ValueIterator>
+class CellSizeErrorIndicator : public ErrorIndicator<PointIterator,ValueIterator>
+{
+public:
+    virtual Double operator()(  ValueIterator it_valueBegin,
+                                ValueIterator it_valueEnd,
+                                PointIterator it_pointBegin ) const override;
+};
+
+
+} // namespace cie::csg
+
+#include "CSG/packages/trees/impl/CellSizeErrorIndicator_impl.hpp"
+
+#endif
\ No newline at end of file
@@ -25,8 +25,13 @@ public:
     virtual typename PrimitiveType::point_type getSamplePoint( const PrimitiveType& r_primitive,
                                                                Size index ) const override;
 
+    virtual void getSamplePoints( const PrimitiveType& r_primitive,
+                                  typename PrimitiveType::coordinate_type* p_coordinates ) const override;
+
     virtual Size size() const override;
 
+    virtual Size nestedGridSize() const override;
+
 protected:
     CartesianIndexConverterPtr<PrimitiveType::dimension> _p_indexConverter;
 };
@@ -41,8 +46,13 @@ public:
     virtual typename PrimitiveType::point_type getSamplePoint( const PrimitiveType& r_primitive,
                                                                Size index ) const override;
 
+    virtual void getSamplePoints( const PrimitiveType& r_primitive,
+                                  typename PrimitiveType::coordinate_type* p_coordinates ) const override;
+
     virtual Size size() const override;
 
+    virtual Size nestedGridSize() const override;
+
 protected:
     CartesianIndexConverterPtr<PrimitiveType::dimension> _p_indexConverter;
 };
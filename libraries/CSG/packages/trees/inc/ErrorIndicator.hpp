@@ -0,0 +1,49 @@
+#ifndef CIE_CSG_ERROR_INDICATOR_HPP
+#define CIE_CSG_ERROR_INDICATOR_HPP
+
+// --- Utility Includes ---
+#include "cieutils/packages/concepts/inc/iterator_concepts.hpp"
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <memory>
+
+
+namespace cie::csg {
+
+/**
+ * Interface for estimating how much a cell would gain
+ * from being refined. The estimate is based on a set
+ * of point-value pairs (like in SplitPolicy) and must
+ * be implemented in derived classes.
+ * Cells with larger errors are refined first, cells
+ * with non-positive errors are not refined at all.
+*/
+template <  concepts::IteratorType PointIterator,
+            concepts::IteratorType ValueIterator>
+class ErrorIndicator
+{
+public:
+    typedef PointIterator                       point_iterator_type;
+    typedef ValueIterator                       value_iterator_type;
+    typedef typename PointIterator::value_type  point_type;
+    typedef typename ValueIterator::value_type  value_type;
+
+public:
+    virtual ~ErrorIndicator() {}
+
+    virtual Double operator()(  ValueIterator it_valueBegin,
+                                ValueIterator it_valueEnd,
+                                PointIterator it_pointBegin ) const = 0;
+};
+
+
+
+template <  concepts::IteratorType PointIterator,
+            concepts::IteratorType ValueIterator >
+using ErrorIndicatorPtr = std::shared_ptr<ErrorIndicator<PointIterator,ValueIterator>>;
+
+
+} // namespace cie::csg
+
+#endif
\ No newline at end of file
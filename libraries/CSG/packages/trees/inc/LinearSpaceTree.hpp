@@ -0,0 +1,180 @@
+#ifndef CIE_CSG_LINEAR_SPACE_TREE_HPP
+#define CIE_CSG_LINEAR_SPACE_TREE_HPP
+
+// --- Utility Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolSingleton.hpp"
+
+// --- Internal Includes ---
+#include "CSG/packages/primitives/inc/Box.hpp"
+#include "CSG/packages/trees/inc/PrimitiveSampler.hpp"
+#include "CSG/packages/trees/inc/SpaceTreeNode.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+namespace cie::csg {
+
+
+/**
+ * Space tree with midpoint splitting that stores only its leaves: an alternative
+ * to SpaceTreeNode for deep trees.
+ *
+ * Leaves are identified by Morton keys: a leading 1 bit followed by 'Dimension' bits
+ * per level, the child index of each level (bit 'i' is set for the upper half along
+ * dimension 'i'). The key of a child is (parentKey << Dimension) | childIndex.
+ * Leaves are kept in Morton (depth-first) order, which is the order SpaceTreeNode::visit
+ * reaches the leaves of a tree with the same root and midpoint splitting.
+ *
+ * Each leaf takes a key and a boundary flag; sample values are not stored, so
+ * internal nodes need not exist at all.
+*/
+template <  Size Dimension,
+            concepts::NumericType CoordinateType,
+            class ValueType >
+class LinearSpaceTree : public CSGTraits<Dimension,CoordinateType>
+{
+public:
+    using key_type              = std::uint64_t;
+    using flag_type             = std::uint8_t;
+    using value_type            = ValueType;
+    using typename CSGTraits<Dimension,CoordinateType>::point_type;
+
+    using primitive_type        = Box<Dimension,CoordinateType>;
+    using sampler_ptr           = PrimitiveSamplerPtr<primitive_type>;
+
+    using target_function       = TargetFunction<point_type,value_type>;
+    using batch_target_function = BatchTargetFunction<point_type,value_type>;
+
+    /// Index of nonexistent leaves
+    static constexpr Size npos = std::numeric_limits<Size>::max();
+
+    /// Deepest level representable by the keys
+    static constexpr Size maxLevel = (std::numeric_limits<key_type>::digits - 1) / Dimension;
+
+public:
+    /// Tree with a single (unevaluated) leaf: the root
+    LinearSpaceTree( sampler_ptr p_sampler,
+                     const point_type& r_base,
+                     const point_type& r_lengths );
+
+    /**
+     * Rebuild the tree: evaluate the target at the sample points of the root,
+     * and split cells (recursively) if the results have mixed signs, until
+     * the specified level is reached.
+     * The subdivision runs on the default thread pool.
+     * @return true if the root was split
+    */
+    bool divide( const target_function& r_target,
+                 Size level );
+
+    bool divide( const target_function& r_target,
+                 Size level,
+                 mp::ThreadPool& r_threadPool );
+
+    bool divide( const batch_target_function& r_target,
+                 Size level );
+
+    bool divide( const batch_target_function& r_target,
+                 Size level,
+                 mp::ThreadPool& r_threadPool );
+
+    /// Update the boundary flags of all leaves (without refining them)
+    void evaluate( const target_function& r_target );
+
+    void evaluate( const target_function& r_target,
+                   mp::ThreadPool& r_threadPool );
+
+    void evaluate( const batch_target_function& r_target );
+
+    void evaluate( const batch_target_function& r_target,
+                   mp::ThreadPool& r_threadPool );
+
+    /// Number of leaves
+    Size size() const;
+
+    key_type key( Size leafIndex ) const;
+
+    Size level( Size leafIndex ) const;
+
+    /// Throws if the tree has not been evaluated yet
+    bool isBoundary( Size leafIndex ) const;
+
+    /// Geometry of a leaf
+    primitive_type cell( Size leafIndex ) const;
+
+    /// Index of the leaf containing a point (npos if the point is outside the root)
+    Size find( const point_type& r_point ) const;
+
+    /**
+     * Index of the leaf across a face of the specified leaf, at the lower corner
+     * of the face (npos at the boundary of the root). The neighbor may be
+     * larger, smaller or of the same size.
+    */
+    Size findNeighbor( Size leafIndex,
+                       Size dimension,
+                       bool isPositiveDirection ) const;
+
+    /// Leaf keys in Morton order
+    const std::vector<key_type>& keys() const;
+
+    /// Boundary flags of the leaves (1:true 0:false)
+    const std::vector<flag_type>& boundaryFlags() const;
+
+    const primitive_type& root() const;
+
+    const sampler_ptr& sampler() const;
+
+    static Size levelOf( key_type key );
+
+protected:
+    template <class TargetType>
+    bool divide_internal( const TargetType& r_target,
+                          Size level,
+                          mp::ThreadPool& r_pool );
+
+    /// Append the leaves of a cell's subtree in Morton order
+    template <class TargetType>
+    void divideCell( const TargetType& r_target,
+                     key_type key,
+                     Size level,
+                     mp::ThreadPool& r_pool,
+                     std::vector<key_type>& r_keys,
+                     std::vector<flag_type>& r_flags ) const;
+
+    template <class TargetType>
+    void evaluate_internal( const TargetType& r_target,
+                            mp::ThreadPool& r_pool );
+
+    /// Evaluate the target at the sample points of a cell, return true if they have mixed signs
+    template <class TargetType>
+    bool evaluateCell( const TargetType& r_target,
+                       key_type key ) const;
+
+    void getCell( key_type key,
+                  primitive_type& r_cell ) const;
+
+    /// Integer coordinates of a cell on the grid of its level
+    std::array<key_type,Dimension> decode( key_type key ) const;
+
+    key_type encode( const std::array<key_type,Dimension>& r_coordinates,
+                     Size level ) const;
+
+    /// Index of the leaf containing the cell of the specified key
+    Size findKey( key_type key ) const;
+
+private:
+    sampler_ptr             _p_sampler;
+    primitive_type          _root;
+    std::vector<key_type>   _keys;
+    std::vector<flag_type>  _flags; // empty if unevaluated
+};
+
+
+} // namespace cie::csg
+
+#include "CSG/packages/trees/impl/LinearSpaceTree_impl.hpp"
+
+#endif
\ No newline at end of file
@@ -24,7 +24,24 @@ public:
     virtual ~PrimitiveSampler() {}
 
     virtual typename PrimitiveType::point_type getSamplePoint( const PrimitiveType& r_primitive, Size index ) const = 0;
+
+    /**
+     * Compute all sample points at once in structure-of-arrays layout:
+     * component 'i' of point 'j' goes to p_coordinates[i*size() + j].
+     * The default implementation calls getSamplePoint for each point.
+    */
+    virtual void getSamplePoints( const PrimitiveType& r_primitive,
+                                  typename PrimitiveType::coordinate_type* p_coordinates ) const;
+
     virtual Size size() const = 0;
+
+    /**
+     * Number of points per dimension if the sample points form a Cartesian grid
+     * that includes the boundaries of the primitive (in CartesianIndexConverter order),
+     * 0 otherwise. Such grids are nested under bisection, so refined cells can reuse
+     * the values of their parents.
+    */
+    virtual Size nestedGridSize() const;
 };
 
 
@@ -34,4 +51,6 @@ using PrimitiveSamplerPtr   = std::shared_ptr<PrimitiveSampler<PrimitiveType>>;
 
 } // namespace cie::csg
 
+#include "CSG/packages/trees/impl/PrimitiveSampler_impl.hpp"
+
 #endif
\ No newline at end of file
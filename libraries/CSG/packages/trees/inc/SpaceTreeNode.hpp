@@ -6,20 +6,25 @@
 
 // --- Utility Includes ---
 #include "cieutils/packages/trees/inc/abstree.hpp"
-#include "cieutils/packages/concurrency/inc/ThreadSafeMap.hpp"
+#include "cieutils/packages/stl_extension/inc/hash.hpp"
+#include "cieutils/packages/concurrency/inc/ConcurrentHashMap.hpp"
 #include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolSingleton.hpp"
 
 // --- Internal Includes ---
 #include "CSG/packages/trees/inc/AbsCell.hpp"
 #include "CSG/packages/trees/inc/SplitPolicy.hpp"
+#include "CSG/packages/trees/inc/ErrorIndicator.hpp"
 #include "CSG/packages/trees/inc/CartesianIndexConverter.hpp"
+#include "CSG/packages/trees/inc/ValueStore.hpp"
 
 // --- STL Includes ---
 #include <deque>
 #include <stdint.h>
 #include <memory>
 #include <functional>
-#include <map>
+#include <span>
+#include <limits>
 
 namespace cie::csg {
 
@@ -31,6 +36,16 @@ template <  concepts::NumericContainer PointType,
 using TargetFunction = std::function<ValueType(const PointType&)>;
 
 
+/**
+ * Target function that evaluates all sample points of a cell in one call.
+ * Arguments: coordinates in structure-of-arrays layout (component 'i' of point 'j'
+ * at [i*numberOfPoints + j]), number of points, output array for the values.
+*/
+template <  concepts::NumericContainer PointType,
+            class ValueType >
+using BatchTargetFunction = std::function<void(const typename PointType::value_type*,Size,ValueType*)>;
+
+
 
 /* --- SpaceTreeNode --- */
 
@@ -55,9 +70,9 @@ public:
             _r_node( r_node )
         { **this; }
         sample_point_iterator& operator++()                         { ++_counter; return *this; };
-        sample_point_iterator& operator++(int)                      { _counter++; return *this; }
+        sample_point_iterator operator++(int)                       { auto copy = *this; ++_counter; return copy; }
         sample_point_iterator& operator--()                         { --_counter; return *this; }
-        sample_point_iterator& operator--(int)                      { _counter--; return *this; }
+        sample_point_iterator operator--(int)                       { auto copy = *this; --_counter; return copy; }
         sample_point_iterator& operator+=( Size offset )            { _counter += offset; return *this; }
         sample_point_iterator& operator-=( Size offset )            { _counter -= offset; return *this; }
         const value_type& operator*()                               { updatePoint(); return _point; }
@@ -65,7 +80,7 @@ public:
         bool operator!=( const sample_point_iterator& r_rhs )       { return this->_counter != r_rhs._counter;}
 
     protected:
-        void updatePoint()                                          { _point = _r_node._p_sampler->getSamplePoint(_r_node,_counter); }
+        void updatePoint()                                          { _point = _r_node.sampler()->getSamplePoint(_r_node,_counter); }
 
     private:
         Size                                        _counter;
@@ -76,17 +91,36 @@ public:
 public:
     using cell_type             = CellType;
     using value_type            = ValueType;
-    using value_container_type  = std::vector<value_type>;
-    using value_iterator        = typename value_container_type::const_iterator;
+    using value_container_type  = std::span<const value_type>;
+    using value_iterator        = typename value_container_type::iterator;
 
     using sampler_ptr           = PrimitiveSamplerPtr<typename CellType::primitive_type>;
     using split_policy_ptr      = SplitPolicyPtr<sample_point_iterator,value_iterator>;
+    using value_store_ptr       = ValueStorePtr<value_type>;
+    using error_indicator_ptr   = ErrorIndicatorPtr<sample_point_iterator,value_iterator>;
+
+    /// Objects shared by the nodes of a tree (children get the data of their parent)
+    struct shared_data
+    {
+        sampler_ptr         p_sampler;
+        split_policy_ptr    p_splitPolicy;
+        value_store_ptr     p_valueStore;
+    };
+
+    using shared_data_ptr       = std::shared_ptr<shared_data>;
 
-    using target_map_base_type  = std::map<typename cell_type::point_type, value_type>;
-    using target_map_type       = mp::ThreadSafeMap<target_map_base_type>;
+    using target_map_type       = mp::ConcurrentHashMap<typename cell_type::point_type, value_type, utils::ContainerHash>;
     using target_map_ptr        = std::shared_ptr<target_map_type>;
 
     using target_function       = TargetFunction<typename CellType::point_type,value_type>;
+    using batch_target_function = BatchTargetFunction<typename CellType::point_type,value_type>;
+
+    /// Budget of an adaptive refinement, or the cost it actually had
+    struct refinement_cost
+    {
+        Size numberOfNodes       = std::numeric_limits<Size>::max();
+        Size numberOfEvaluations = std::numeric_limits<Size>::max();
+    };
 
 public:
     /**
@@ -99,9 +133,28 @@ public:
                     Size level,
                     Args&&... args );
 
+    /// Constructor for nodes that share the sampler, split policy and value store of a tree
+    template <class ...Args>
+    SpaceTreeNode(  shared_data_ptr p_sharedData,
+                    Size level,
+                    Args&&... args );
+
+    /// Copies the values into the value store of the copied node
+    SpaceTreeNode( const SpaceTreeNode<CellType,ValueType>& r_rhs );
+
+    SpaceTreeNode<CellType,ValueType>& operator=( const SpaceTreeNode<CellType,ValueType>& r_rhs );
+
+    /// Returns the values to the store
+    ~SpaceTreeNode();
+
     /**
      * Evaluate the target function at all sample points and split the
      * node if the results have mixed signs.
+     * The subdivision runs on the default thread pool.
+     *
+     * If the sampler is a nested grid and the cell is bisected, children
+     * take the values at sample points they share with their parent or with
+     * their siblings instead of evaluating the target again (see evaluateChildren).
     */
     bool divide( const target_function& r_target,
                  Size level );
@@ -110,6 +163,40 @@ public:
                  Size level,
                  mp::ThreadPool& r_threadPool );
 
+    /**
+     * Same as the point-wise versions, but the target evaluates all
+     * sample points of a cell at once.
+    */
+    bool divide( const batch_target_function& r_target,
+                 Size level );
+
+    bool divide( const batch_target_function& r_target,
+                 Size level,
+                 mp::ThreadPool& r_threadPool );
+
+    /**
+     * Adaptive alternative to divide: evaluate this node, then repeatedly split
+     * the leaf with the largest error (as estimated by the error indicator) until
+     * no leaf below the specified level has a positive error, or the next split
+     * could exceed the budget.
+     *
+     * A split is only done if the budget covers all sample points of the new children,
+     * so the cost never exceeds the budget (shared sample points are still reused,
+     * see evaluateChildren). Existing children of this node are discarded.
+     * The refinement runs sequentially, because the order of the splits matters.
+     *
+     * @return number of nodes in the tree and number of target evaluations
+    */
+    refinement_cost refine( const target_function& r_target,
+                            Size level,
+                            error_indicator_ptr p_errorIndicator,
+                            const refinement_cost& r_budget = refinement_cost() );
+
+    refinement_cost refine( const batch_target_function& r_target,
+                            Size level,
+                            error_indicator_ptr p_errorIndicator,
+                            const refinement_cost& r_budget = refinement_cost() );
+
     /**
      * Evaluate the target function at all sample points, store the results in a map,
      * and split the node if the results have mixed signs.
@@ -123,11 +210,18 @@ public:
     */ 
     virtual void evaluate( const target_function& r_target );
 
+    /**
+     * Compute all sample points in one sampler call and pass them to the target
+     * in a single block, so there are no indirect calls per point.
+    */
+    virtual void evaluate( const batch_target_function& r_target );
+
     /**
      * Alternative to evaluate.
      * Record sample points and their values in a global map, then set the isBoundary flag.
      * 
-     * Note: insane overhead; probably only worth it if the target function is very expensive
+     * Note: the map is shared between threads, so this is only worth it if
+     * the target function is expensive compared to hashing a point
     */
     target_map_ptr evaluateMap( const target_function& r_target,
                                 target_map_ptr p_targetMap = nullptr );
@@ -142,25 +236,69 @@ public:
     */
     bool isBoundary() const;
 
+    /// Nodes created afterwards use the new objects, existing children are not affected
     void setSplitPolicy( split_policy_ptr p_splitPolicy );
     void setSampler( sampler_ptr p_sampler );
 
     const split_policy_ptr& splitPolicy() const;
-    const value_container_type& values() const;
+
+    /// Values at the sample points (empty if the node is unevaluated)
+    value_container_type values() const;
+
     const sampler_ptr& sampler() const;
 
+    /// Store of the values of this node (shared with the rest of the tree)
+    const value_store_ptr& valueStore() const;
+
 protected:
-    bool divide_internal( const target_function& r_target,
+    /// Skips the evaluation of this node if it was done by its parent
+    template <class TargetType>
+    bool divide_internal( const TargetType& r_target,
                           Size level,
-                          mp::ThreadPool& r_pool );
+                          mp::ThreadPool& r_pool,
+                          bool isEvaluated = false );
 
-protected:
-    split_policy_ptr        _p_splitPolicy;
+    /**
+     * Evaluate all children of this node together, on a lattice with twice the
+     * resolution of the sampler's grid: values of this node are copied to the lattice,
+     * and points shared by siblings are evaluated only once.
+     * @return false (without evaluating anything) if the sampler is not a nested grid
+     * or the children are not the halves of this cell
+    */
+    template <class TargetType>
+    bool evaluateChildren( const TargetType& r_target );
+
+    template <class TargetType>
+    refinement_cost refine_internal( const TargetType& r_target,
+                                     Size level,
+                                     const error_indicator_ptr& rp_errorIndicator,
+                                     const refinement_cost& r_budget );
+
+private:
+    /// Split this node at the point given by the split policy, and keep the non-degenerate children
+    void makeChildren();
+
+    /// Error of this node according to the indicator (requires values)
+    Double error( const error_indicator_ptr& rp_errorIndicator ) const;
+
+    /// Create a value store if none is provided
+    static shared_data_ptr makeSharedData( sampler_ptr p_sampler,
+                                           split_policy_ptr p_splitPolicy,
+                                           value_store_ptr p_valueStore );
+
+    /// Get a slice from the value store if the node has none yet
+    ValueType* allocateValues();
+
+    /// Return the values to the store
+    void releaseValues();
+
+    /// Set the isBoundary flag from the stored values
+    void updateBoundaryFlag();
 
 private:
-    value_container_type    _values;
-    sampler_ptr             _p_sampler;
-    int8_t                  _isBoundary; // 1:true 0:false -1:unevaluated
+    shared_data_ptr         _p_sharedData;
+    ValueType*              _p_values;      // slice of the value store (sampler()->size() values)
+    int8_t                  _isBoundary;    // 1:true 0:false -1:unevaluated
 };
 
 
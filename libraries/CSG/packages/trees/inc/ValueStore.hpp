@@ -0,0 +1,107 @@
+#ifndef CIE_CSG_VALUE_STORE_HPP
+#define CIE_CSG_VALUE_STORE_HPP
+
+// --- Utility Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+namespace cie::csg {
+
+
+/**
+ * Pool of fixed-size arrays ('slices') for the sample values of space tree nodes.
+ *
+ * Slices are cut from large blocks, so nodes of a tree need no allocations of
+ * their own and their values are close to each other in memory. Released slices
+ * are reused by later allocations; blocks are freed with the store.
+ * Allocation and release are thread-safe: the store is split into independently
+ * locked shards and each thread works on its own shard, so threads only contend
+ * if there are more of them than shards. A shard that runs out of slices takes
+ * the ones released on other shards before cutting a new block.
+*/
+template <class ValueType>
+class ValueStore
+{
+public:
+    using value_type = ValueType;
+
+public:
+    /**
+     * @param sliceSize number of values per slice
+     * @param blockSize number of slices per block
+     * @param numberOfShards minimum number of shards (rounded up to a power of 2)
+    */
+    ValueStore( Size sliceSize,
+                Size blockSize = 256,
+                Size numberOfShards = 16 );
+
+    ValueStore( const ValueStore<ValueType>& r_rhs ) = delete;
+    ValueStore<ValueType>& operator=( const ValueStore<ValueType>& r_rhs ) = delete;
+
+    /// Get an uninitialized slice
+    ValueType* allocate();
+
+    /// Return a slice to the store (null is ignored)
+    void release( ValueType* p_slice );
+
+    Size sliceSize() const;
+
+    /// Number of slices in use
+    Size size() const;
+
+    /// Number of slices in the allocated blocks
+    Size capacity() const;
+
+    Size numberOfShards() const;
+
+private:
+    /// Blocks and free slices of a group of threads, padded to avoid false sharing
+    struct alignas(64) Shard
+    {
+        std::vector<std::unique_ptr<ValueType[]>>   blocks;
+        std::vector<ValueType*>                     freeSlices;
+        Size                                        numberOfCutSlices; // in the last block
+        Size                                        size; // may wrap if slices are released on another shard
+        mutable std::mutex                          mutex;
+    };
+
+    /// Shard of the calling thread
+    Shard& shard() const;
+
+    /// Get a slice from a locked shard
+    ValueType* allocate( Shard& r_shard );
+
+private:
+    Size                                _sliceSize;
+    Size                                _blockSize;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+
+namespace detail {
+/// Process-wide index of the calling thread, assigned on first use
+inline Size valueStoreThreadIndex()
+{
+    static std::atomic<Size> counter = 0;
+    thread_local Size index = Size(-1); // constant initialization keeps the access cheap
+    if ( index == Size(-1) )
+        index = counter++;
+    return index;
+}
+} // namespace detail
+
+
+template <class ValueType>
+using ValueStorePtr = std::shared_ptr<ValueStore<ValueType>>;
+
+
+} // namespace cie::csg
+
+#include "CSG/packages/trees/impl/ValueStore_impl.hpp"
+
+#endif
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 // --- STL Includes ---
 #include <memory>
+#include <vector>
 
 
 namespace cie::csg {
@@ -124,6 +125,33 @@ CIE_TEST_CASE( "CartesianGridSampler", "[trees]" )
         CIE_TEST_CHECK( point[0] == 3.0 );
         CIE_TEST_CHECK( point[1] == 6.0 );
     }
+
+    {
+        CIE_TEST_CASE_INIT( "structure-of-arrays sampling" )
+
+        auto check = []<class PrimitiveType>( const PrimitiveType& r_primitive ) -> void
+        {
+            for ( Size numberOfPointsPerDimension : {1, 2, 5} )
+            {
+                CartesianGridSampler<PrimitiveType> sampler( numberOfPointsPerDimension );
+                const Size size = sampler.size();
+
+                std::vector<CT> coordinates( Dimension * size );
+                CIE_TEST_CHECK_NOTHROW( sampler.getSamplePoints( r_primitive, coordinates.data() ) );
+
+                // Must be identical to the point-wise sampling
+                for ( Size i_point=0; i_point<size; ++i_point )
+                {
+                    const auto point = sampler.getSamplePoint( r_primitive, i_point );
+                    for ( Size dim=0; dim<Dimension; ++dim )
+                        CIE_TEST_CHECK( coordinates[dim*size + i_point] == point[dim] );
+                }
+            }
+        };
+
+        check( boolean::Cube<Dimension,CT>( {1.0, 2.0}, 2.0 ) );
+        check( boolean::Box<Dimension,CT>( {1.0, 2.0}, {2.0, 0.3} ) );
+    }
 }
 
 
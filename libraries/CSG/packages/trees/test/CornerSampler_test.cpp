@@ -4,6 +4,9 @@
 // --- Internal Includes ---
 #include "CSG/packages/trees/inc/CornerSampler.hpp"
 
+// --- STL Includes ---
+#include <vector>
+
 
 namespace cie::csg {
 
@@ -70,6 +73,12 @@ CIE_TEST_CASE( "CornerSampler", "[trees]" )
         CIE_TEST_CHECK_NOTHROW( samplePoint = sampler.getSamplePoint(primitive, 3) );
         CIE_TEST_CHECK( samplePoint[0] == Approx(0.0) );
         CIE_TEST_CHECK( samplePoint[1] == Approx(2.0) );
+
+        // Structure-of-arrays sampling
+        std::vector<double> coordinates( 2 * sampler.size() );
+        CIE_TEST_CHECK_NOTHROW( sampler.getSamplePoints(primitive, coordinates.data()) );
+        CIE_TEST_CHECK( coordinates == std::vector<double>({ -1.0, 0.0, -1.0, 0.0,
+                                                              0.0, 0.0,  2.0, 2.0 }) );
     }
 }
 
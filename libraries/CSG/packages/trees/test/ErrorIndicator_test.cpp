@@ -0,0 +1,54 @@
+// --- Utility Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+
+// --- Internal Includes ---
+#include "CSG/packages/trees/inc/CellSizeErrorIndicator.hpp"
+
+// --- STL Includes ---
+#include <array>
+#include <vector>
+#include <deque>
+
+
+namespace cie::csg {
+
+
+CIE_TEST_CASE( "CellSizeErrorIndicator", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "CellSizeErrorIndicator" )
+
+    const Size Dimension    = 2;
+    using CoordinateType    = Double;
+    using PointType         = std::array<CoordinateType,Dimension>;
+    using ValueType         = int;
+
+    std::vector<PointType> points;
+    points.push_back( PointType({ 0.0, 0.0 }) );
+    points.push_back( PointType({ 2.0, 0.0 }) );
+    points.push_back( PointType({ 0.0, 0.5 }) );
+    points.push_back( PointType({ 2.0, 0.5 }) );
+
+    using Indicator = CellSizeErrorIndicator< typename std::vector<PointType>::iterator,
+                                              typename std::deque<ValueType>::iterator >;
+    Indicator indicator;
+
+    // Not cut
+    std::deque<ValueType> values { 1, 2, 3, 4 };
+    CIE_TEST_CHECK( indicator(values.begin(), values.end(), points.begin()) == 0.0 );
+
+    values = { -1, -2, 0, -4 };
+    CIE_TEST_CHECK( indicator(values.begin(), values.end(), points.begin()) == 0.0 );
+
+    // Cut => largest extent
+    values = { -1, 2, 3, -3 };
+    CIE_TEST_CHECK( indicator(values.begin(), values.end(), points.begin()) == Approx(2.0) );
+
+    values = { 1, 1, 1, 0 };
+    CIE_TEST_CHECK( indicator(values.begin(), values.end(), points.begin()) == Approx(2.0) );
+
+    // No points
+    CIE_TEST_CHECK( indicator(values.begin(), values.begin(), points.begin()) == 0.0 );
+}
+
+
+} // namespace cie::csg
\ No newline at end of file
@@ -0,0 +1,191 @@
+// --- Utility Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+
+// --- Internal Includes ---
+#include "CSG/packages/trees/inc/LinearSpaceTree.hpp"
+#include "CSG/packages/trees/inc/SpaceTreeNode.hpp"
+#include "CSG/packages/trees/inc/Cell.hpp"
+#include "CSG/packages/trees/inc/MidPointSplitPolicy.hpp"
+#include "CSG/packages/trees/inc/CartesianGridSampler.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <cmath>
+
+
+namespace cie::csg {
+
+
+CIE_TEST_CASE( "LinearSpaceTree", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "LinearSpaceTree" )
+
+    const Size Dimension    = 2;
+    using CoordinateType    = Double;
+    using ValueType         = Double;
+    using TreeType          = LinearSpaceTree<Dimension,CoordinateType,ValueType>;
+    using PointType         = TreeType::point_type;
+    using PrimitiveType     = TreeType::primitive_type;
+    using NodeType          = SpaceTreeNode<Cell<PrimitiveType>,ValueType>;
+    const Size depth        = 6;
+
+    const PointType base    = { -0.5, -0.4 };
+    const PointType lengths = { 1.6, 1.7 };
+
+    auto p_sampler = TreeType::sampler_ptr( new CartesianGridSampler<PrimitiveType>(3) );
+
+    TreeType::target_function target = []( const PointType& r_point ) -> ValueType
+    {
+        return 1.0 - r_point[0]*r_point[0] - r_point[1]*r_point[1];
+    };
+
+    TreeType::batch_target_function batchTarget = []( const CoordinateType* p_coordinates,
+                                                      Size numberOfPoints,
+                                                      ValueType* p_values ) -> void
+    {
+        for ( Size i=0; i<numberOfPoints; ++i )
+            p_values[i] = 1.0 - p_coordinates[i]*p_coordinates[i] - p_coordinates[numberOfPoints+i]*p_coordinates[numberOfPoints+i];
+    };
+
+    TreeType tree( p_sampler, base, lengths );
+    CIE_TEST_CHECK( tree.size() == 1 );
+    CIE_TEST_CHECK( tree.level(0) == 0 );
+    CIE_TEST_CHECK_THROWS( tree.isBoundary(0) );
+    CIE_TEST_CHECK_THROWS( tree.divide(target, TreeType::maxLevel + 1) );
+
+    CIE_TEST_REQUIRE_NOTHROW( tree.divide(target, depth) );
+    CIE_TEST_REQUIRE( tree.size() > 1 );
+    CIE_TEST_CHECK( tree.boundaryFlags().size() == tree.size() );
+
+    auto isClose = []( CoordinateType left, CoordinateType right ) -> bool
+    { return std::abs(left - right) < 1e-12; };
+
+    {
+        CIE_TEST_CASE_INIT( "same leaves as SpaceTreeNode" )
+
+        NodeType root(
+            p_sampler,
+            NodeType::split_policy_ptr( new MidPointSplitPolicy<NodeType::sample_point_iterator,NodeType::value_iterator>() ),
+            0,
+            base,
+            lengths
+        );
+        CIE_TEST_REQUIRE_NOTHROW( root.divide(target, depth) );
+
+        std::vector<const NodeType*> leaves;
+        root.visit( [&leaves]( NodeType* p_node ) { if (p_node->isLeaf()) leaves.push_back(p_node); return true; } );
+
+        CIE_TEST_REQUIRE( leaves.size() == tree.size() );
+        for ( Size i_leaf=0; i_leaf<tree.size(); ++i_leaf )
+        {
+            CIE_TEST_CHECK( tree.level(i_leaf) == leaves[i_leaf]->level() );
+            CIE_TEST_CHECK( tree.isBoundary(i_leaf) == leaves[i_leaf]->isBoundary() );
+
+            const auto cell = tree.cell( i_leaf );
+            for ( Size dim=0; dim<Dimension; ++dim )
+            {
+                CIE_TEST_CHECK( isClose(cell.base()[dim], leaves[i_leaf]->base()[dim]) );
+                CIE_TEST_CHECK( isClose(cell.lengths()[dim], leaves[i_leaf]->lengths()[dim]) );
+            }
+        }
+
+        // Children follow their parent
+        for ( Size i_leaf=1; i_leaf<tree.size(); ++i_leaf )
+            CIE_TEST_CHECK( tree.key(i_leaf-1) < tree.key(i_leaf) << (Dimension * (depth - tree.level(i_leaf))) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "batch target" )
+
+        TreeType batchTree( p_sampler, base, lengths );
+        CIE_TEST_REQUIRE_NOTHROW( batchTree.divide(batchTarget, depth) );
+        CIE_TEST_CHECK( batchTree.keys() == tree.keys() );
+        CIE_TEST_CHECK( batchTree.boundaryFlags() == tree.boundaryFlags() );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "evaluate" )
+
+        TreeType copy = tree;
+        const auto flags = tree.boundaryFlags();
+
+        // Same sign changes
+        CIE_TEST_CHECK_NOTHROW( copy.evaluate( TreeType::target_function([&target](const PointType& r_point) { return -target(r_point); }) ) );
+        CIE_TEST_CHECK( copy.boundaryFlags() == flags );
+        CIE_TEST_CHECK( copy.keys() == tree.keys() );
+
+        // No sign changes
+        CIE_TEST_CHECK_NOTHROW( copy.evaluate( TreeType::batch_target_function(
+            []( const CoordinateType*, Size numberOfPoints, ValueType* p_values ) { std::fill(p_values, p_values+numberOfPoints, 1.0); }
+        ) ) );
+        for ( Size i_leaf=0; i_leaf<copy.size(); ++i_leaf )
+            CIE_TEST_CHECK( !copy.isBoundary(i_leaf) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "find" )
+
+        CIE_TEST_CHECK( tree.find(PointType {-0.6, 0.0}) == TreeType::npos );
+        CIE_TEST_CHECK( tree.find(PointType {0.0, 1.31}) == TreeType::npos );
+        CIE_TEST_CHECK( tree.find(base) == 0 );
+        CIE_TEST_CHECK( tree.find(PointType {1.09, 1.29}) == tree.size() - 1 );
+
+        for ( Size i=0; i<=20; ++i )
+            for ( Size j=0; j<=20; ++j )
+            {
+                const PointType point = { base[0] + i*lengths[0]/20, base[1] + j*lengths[1]/20 };
+                const Size leafIndex  = tree.find( point );
+                CIE_TEST_REQUIRE( leafIndex < tree.size() );
+
+                const auto cell = tree.cell( leafIndex );
+                for ( Size dim=0; dim<Dimension; ++dim )
+                {
+                    CIE_TEST_CHECK( cell.base()[dim] - 1e-12 <= point[dim] );
+                    CIE_TEST_CHECK( point[dim] <= cell.base()[dim] + cell.lengths()[dim] + 1e-12 );
+                }
+            }
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "findNeighbor" )
+
+        CIE_TEST_CHECK_THROWS( tree.findNeighbor(tree.size(), 0, true) );
+
+        for ( Size i_leaf=0; i_leaf<tree.size(); ++i_leaf )
+        {
+            const auto cell = tree.cell( i_leaf );
+
+            for ( Size dim=0; dim<Dimension; ++dim )
+                for ( bool isPositiveDirection : {false, true} )
+                {
+                    const Size neighborIndex = tree.findNeighbor( i_leaf, dim, isPositiveDirection );
+                    const CoordinateType face = cell.base()[dim] + (isPositiveDirection ? cell.lengths()[dim] : 0.0);
+
+                    // Leaves without neighbors are on the boundary of the root
+                    if ( neighborIndex == TreeType::npos )
+                    {
+                        CIE_TEST_CHECK( isClose(face, base[dim] + (isPositiveDirection ? lengths[dim] : 0.0)) );
+                        continue;
+                    }
+
+                    CIE_TEST_REQUIRE( neighborIndex < tree.size() );
+                    CIE_TEST_CHECK( neighborIndex != i_leaf );
+
+                    // Neighbors share (a part of) a face, including its lower corner
+                    const auto neighbor = tree.cell( neighborIndex );
+                    const CoordinateType neighborFace = neighbor.base()[dim] + (isPositiveDirection ? 0.0 : neighbor.lengths()[dim]);
+                    CIE_TEST_CHECK( isClose(face, neighborFace) );
+
+                    for ( Size other=0; other<Dimension; ++other )
+                        if ( other != dim )
+                        {
+                            CIE_TEST_CHECK( neighbor.base()[other] <= cell.base()[other] + 1e-12 );
+                            CIE_TEST_CHECK( cell.base()[other] < neighbor.base()[other] + neighbor.lengths()[other] );
+                        }
+                }
+        }
+    }
+}
+
+
+} // namespace cie::csg
\ No newline at end of file
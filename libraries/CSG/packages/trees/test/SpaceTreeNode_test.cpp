@@ -7,13 +7,20 @@
 #include "CSG/packages/trees/inc/MidPointSplitPolicy.hpp"
 #include "CSG/packages/trees/inc/LinearSplitPolicy.hpp"
 #include "CSG/packages/trees/inc/WeightedSplitPolicy.hpp"
+#include "CSG/packages/trees/inc/CellSizeErrorIndicator.hpp"
 #include "CSG/packages/trees/inc/CartesianGridSampler.hpp"
+#include "CSG/packages/trees/inc/CornerSampler.hpp"
 #include "CSG/packages/trees/inc/write.hpp"
 #include "cmake_variables.hpp"
 
 // --- STL includes ---
 #include <deque>
 #include <concepts>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
 
 
 namespace cie::csg {
@@ -39,6 +46,23 @@ ValueType unitCircle( const PointType& r_point )
 }
 
 
+/// Batch version of unitCircle (structure-of-arrays coordinates)
+template <class PointType, class ValueType>
+void unitCircleBatch( const typename PointType::value_type* p_coordinates,
+                      Size numberOfPoints,
+                      ValueType* p_values )
+{
+    for ( Size i=0; i<numberOfPoints; ++i )
+    {
+        PointType point;
+        for ( Size dim=0; dim<point.size(); ++dim )
+            point[dim] = p_coordinates[dim*numberOfPoints + i];
+
+        p_values[i] = unitCircle<PointType,ValueType>( point );
+    }
+}
+
+
 CIE_TEST_CASE( "SpaceTreeNode", "[trees]" )
 {
     CIE_TEST_CASE_INIT( "SpaceTreeNode" )
@@ -106,6 +130,28 @@ CIE_TEST_CASE( "SpaceTreeNode", "[trees]" )
 
         // Divide
         CIE_TEST_CHECK_NOTHROW( root.divide(unitCircle<PointType,BoolValue>, depth) );
+
+        // Evaluate with a shared point-value map
+        auto p_targetMap = std::make_shared<typename NodeType::target_map_type>();
+        NodeType mappedRoot( p_sampler,
+                             p_splitPolicy,
+                             0,
+                             base,
+                             length );
+
+        CIE_TEST_CHECK_NOTHROW( mappedRoot.evaluateMap(unitCircle<PointType,BoolValue>, p_targetMap) );
+        CIE_TEST_CHECK( p_targetMap->size() == 9 );
+        CIE_TEST_CHECK( mappedRoot.isBoundary() );
+        CIE_TEST_REQUIRE( mappedRoot.values().size() == 9 );
+        for ( Size i=0; i<9; ++i )
+            CIE_TEST_CHECK( mappedRoot.values()[i] == root.values()[i] );
+
+        // Cached points are not inserted again, children share points with their parent
+        CIE_TEST_CHECK_NOTHROW( mappedRoot.evaluateMap(unitCircle<PointType,BoolValue>, p_targetMap) );
+        CIE_TEST_CHECK( p_targetMap->size() == 9 );
+
+        CIE_TEST_CHECK_NOTHROW( mappedRoot.divide(unitCircle<PointType,BoolValue>, 1, p_targetMap) );
+        CIE_TEST_CHECK( p_targetMap->size() == 25 );
         
         // Write output
         CIE_TEST_CHECK_NOTHROW( writeToVTK( root, TEST_OUTPUT_PATH / "SpaceTreeNode_cube_midpoint.vtu" ) );
@@ -243,4 +289,378 @@ CIE_TEST_CASE( "SpaceTreeNode", "[trees]" )
 }
 
 
+CIE_TEST_CASE( "SpaceTreeNode batch evaluation", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "SpaceTreeNode batch evaluation" )
+
+    const Size Dimension    = 3;
+    using CoordinateType    = Double;
+    using PointType         = std::array<CoordinateType,Dimension>;
+    using PrimitiveType     = Box<Dimension,CoordinateType>;
+    using CellType          = Cell<PrimitiveType>;
+    const Size depth        = 4;
+
+    auto test = [depth]<class ValueType>( ValueType ) -> void
+    {
+        using NodeType = SpaceTreeNode<CellType,ValueType>;
+
+        auto p_sampler = typename NodeType::sampler_ptr(
+            new CartesianGridSampler<PrimitiveType>( 4 )
+        );
+
+        auto p_splitPolicy = typename NodeType::split_policy_ptr(
+            new MidPointSplitPolicy<typename NodeType::sample_point_iterator,
+                                    typename NodeType::value_iterator>()
+        );
+
+        auto makeRoot = [&]() -> NodeType
+        {
+            return NodeType( p_sampler,
+                             p_splitPolicy,
+                             0,
+                             PointType { -0.9, -0.8, -0.7 },
+                             PointType { 1.6, 1.7, 1.8 } );
+        };
+
+        NodeType pointRoot = makeRoot();
+        NodeType batchRoot = makeRoot();
+
+        // Same values as the point-wise evaluation
+        typename NodeType::batch_target_function batchTarget = unitCircleBatch<PointType,ValueType>;
+        CIE_TEST_CHECK_NOTHROW( pointRoot.evaluate(unitCircle<PointType,ValueType>) );
+        CIE_TEST_CHECK_NOTHROW( batchRoot.evaluate(batchTarget) );
+
+        CIE_TEST_REQUIRE( batchRoot.values().size() == 64 );
+        CIE_TEST_CHECK( std::ranges::equal(batchRoot.values(), pointRoot.values()) );
+        CIE_TEST_CHECK( batchRoot.isBoundary() == pointRoot.isBoundary() );
+
+        // Same tree
+        CIE_TEST_CHECK_NOTHROW( pointRoot.divide(unitCircle<PointType,ValueType>, depth) );
+        CIE_TEST_CHECK_NOTHROW( batchRoot.divide(batchTarget, depth) );
+
+        std::vector<const NodeType*> pointNodes, batchNodes;
+        pointRoot.visit( [&pointNodes]( NodeType* p_node ) { pointNodes.push_back(p_node); return true; } );
+        batchRoot.visit( [&batchNodes]( NodeType* p_node ) { batchNodes.push_back(p_node); return true; } );
+
+        CIE_TEST_REQUIRE( batchNodes.size() == pointNodes.size() );
+        CIE_TEST_CHECK( pointRoot.children().size() > 0 );
+
+        for ( Size i=0; i<batchNodes.size(); ++i )
+        {
+            CIE_TEST_CHECK( std::ranges::equal(batchNodes[i]->values(), pointNodes[i]->values()) );
+            CIE_TEST_CHECK( batchNodes[i]->isBoundary() == pointNodes[i]->isBoundary() );
+        }
+
+        // All values of a tree are in one store
+        const auto& rp_store = batchRoot.valueStore();
+        CIE_TEST_CHECK( rp_store->size() == batchNodes.size() );
+        for ( const auto* p_node : batchNodes )
+            CIE_TEST_CHECK( p_node->valueStore() == rp_store );
+
+        // Slices are reused when the tree is rebuilt
+        const Size capacity = rp_store->capacity();
+        CIE_TEST_CHECK_NOTHROW( batchRoot.divide(batchTarget, depth) );
+        CIE_TEST_CHECK( rp_store->size() == batchNodes.size() );
+        CIE_TEST_CHECK( rp_store->capacity() == capacity );
+
+        // Copies have their own values
+        {
+            NodeType copy = batchRoot;
+            CIE_TEST_CHECK( rp_store->size() == batchNodes.size() + 1 );
+            CIE_TEST_CHECK( copy.values().data() != batchRoot.values().data() );
+            CIE_TEST_CHECK( std::ranges::equal(copy.values(), batchRoot.values()) );
+        }
+        CIE_TEST_CHECK( rp_store->size() == batchNodes.size() );
+
+        batchRoot.clear();
+        CIE_TEST_CHECK( batchRoot.values().empty() );
+        CIE_TEST_CHECK( rp_store->size() == 0 );
+    };
+
+    {
+        CIE_TEST_CASE_INIT( "numeric values" )
+        test( Double(0) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "boolean values" )
+        test( Bool(false) );
+    }
+}
+
+
+CIE_TEST_CASE( "SpaceTreeNode sample reuse", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "SpaceTreeNode sample reuse" )
+
+    const Size Dimension    = 2;
+    using CoordinateType    = Double;
+    using ValueType         = Double;
+    using PointType         = std::array<CoordinateType,Dimension>;
+    using PrimitiveType     = Box<Dimension,CoordinateType>;
+    using CellType          = Cell<PrimitiveType>;
+    using NodeType          = SpaceTreeNode<CellType,ValueType>;
+    const Size depth        = 4;
+
+    std::atomic<Size> counter = 0;
+
+    typename NodeType::target_function target = [&counter]( const PointType& r_point ) -> ValueType
+    {
+        ++counter;
+        return unitCircle<PointType,ValueType>( r_point );
+    };
+
+    typename NodeType::batch_target_function batchTarget = [&counter]( const CoordinateType* p_coordinates,
+                                                                       Size numberOfPoints,
+                                                                       ValueType* p_values ) -> void
+    {
+        counter += numberOfPoints;
+        unitCircleBatch<PointType,ValueType>( p_coordinates, numberOfPoints, p_values );
+    };
+
+    auto makeRoot = []( typename NodeType::sampler_ptr p_sampler,
+                        typename NodeType::split_policy_ptr p_splitPolicy ) -> NodeType
+    {
+        return NodeType( p_sampler,
+                         p_splitPolicy,
+                         0,
+                         PointType { -0.5, -0.4 },
+                         PointType { 1.6, 1.7 } );
+    };
+
+    auto p_midPointPolicy = typename NodeType::split_policy_ptr(
+        new MidPointSplitPolicy<typename NodeType::sample_point_iterator,
+                                typename NodeType::value_iterator>()
+    );
+
+    auto collectNodes = []( NodeType& r_root ) -> std::vector<const NodeType*>
+    {
+        std::vector<const NodeType*> nodes;
+        r_root.visit( [&nodes]( NodeType* p_node ) { nodes.push_back(p_node); return true; } );
+        return nodes;
+    };
+
+    // Every node has the values at its own sample points
+    auto checkValues = [](const std::vector<const NodeType*>& r_nodes) -> void
+    {
+        for ( const NodeType* p_node : r_nodes )
+        {
+            CIE_TEST_REQUIRE( p_node->values().size() == p_node->sampler()->size() );
+            for ( Size i_point=0; i_point<p_node->values().size(); ++i_point )
+            {
+                const auto point = p_node->sampler()->getSamplePoint( *p_node, i_point );
+                CIE_TEST_CHECK( std::abs(p_node->values()[i_point] - unitCircle<PointType,ValueType>(point)) < 1e-12 );
+            }
+        }
+    };
+
+    auto test = [&]( typename NodeType::sampler_ptr p_sampler,
+                     Size numberOfEvaluationsOnFirstLevel ) -> void
+    {
+        const Size numberOfPoints = p_sampler->size();
+
+        // Children share the parent's grid points and the points on their common faces
+        NodeType root = makeRoot( p_sampler, p_midPointPolicy );
+        counter = 0;
+        CIE_TEST_CHECK_NOTHROW( root.divide(target, 1) );
+        CIE_TEST_REQUIRE( root.children().size() == 4 );
+        CIE_TEST_CHECK( counter == numberOfPoints + numberOfEvaluationsOnFirstLevel );
+        checkValues( collectNodes(root) );
+
+        counter = 0;
+        CIE_TEST_CHECK_NOTHROW( root.divide(batchTarget, 1) );
+        CIE_TEST_CHECK( counter == numberOfPoints + numberOfEvaluationsOnFirstLevel );
+        checkValues( collectNodes(root) );
+
+        // Point-wise and batch targets evaluate the same points
+        counter = 0;
+        CIE_TEST_CHECK_NOTHROW( root.divide(target, depth) );
+        const Size numberOfEvaluations = counter;
+        const auto nodes = collectNodes( root );
+        CIE_TEST_CHECK( numberOfEvaluations < nodes.size() * numberOfPoints );
+        checkValues( nodes );
+
+        counter = 0;
+        CIE_TEST_CHECK_NOTHROW( root.divide(batchTarget, depth) );
+        CIE_TEST_CHECK( counter == numberOfEvaluations );
+        CIE_TEST_CHECK( collectNodes(root).size() == nodes.size() );
+        checkValues( collectNodes(root) );
+
+        // No reuse if the children are not halves of their parent
+        NodeType weightedRoot = makeRoot(
+            p_sampler,
+            typename NodeType::split_policy_ptr(
+                new WeightedSplitPolicy<typename NodeType::sample_point_iterator,
+                                        typename NodeType::value_iterator>()
+            )
+        );
+
+        counter = 0;
+        CIE_TEST_CHECK_NOTHROW( weightedRoot.divide(target, depth) );
+        const auto weightedNodes = collectNodes( weightedRoot );
+        CIE_TEST_CHECK( weightedNodes.size() > 1 );
+        CIE_TEST_CHECK( counter == weightedNodes.size() * numberOfPoints );
+        checkValues( weightedNodes );
+    };
+
+    {
+        CIE_TEST_CASE_INIT( "corner sampler" )
+
+        // 3x3 lattice, 4 points known from the parent
+        test( typename NodeType::sampler_ptr(new CornerSampler<PrimitiveType>), 5 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "cartesian grid sampler" )
+
+        // 5x5 lattice, 9 points known from the parent
+        test( typename NodeType::sampler_ptr(new CartesianGridSampler<PrimitiveType>(3)), 16 );
+    }
+}
+
+
+CIE_TEST_CASE( "SpaceTreeNode adaptive refinement", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "SpaceTreeNode adaptive refinement" )
+
+    const Size Dimension    = 2;
+    using CoordinateType    = Double;
+    using ValueType         = Double;
+    using PointType         = std::array<CoordinateType,Dimension>;
+    using PrimitiveType     = Box<Dimension,CoordinateType>;
+    using CellType          = Cell<PrimitiveType>;
+    using NodeType          = SpaceTreeNode<CellType,ValueType>;
+    const Size depth        = 6;
+
+    Size counter = 0;
+
+    typename NodeType::target_function target = [&counter]( const PointType& r_point ) -> ValueType
+    {
+        ++counter;
+        return unitCircle<PointType,ValueType>( r_point );
+    };
+
+    typename NodeType::batch_target_function batchTarget = [&counter]( const CoordinateType* p_coordinates,
+                                                                       Size numberOfPoints,
+                                                                       ValueType* p_values ) -> void
+    {
+        counter += numberOfPoints;
+        unitCircleBatch<PointType,ValueType>( p_coordinates, numberOfPoints, p_values );
+    };
+
+    NodeType root( typename NodeType::sampler_ptr(new CartesianGridSampler<PrimitiveType>(3)),
+                   typename NodeType::split_policy_ptr(
+                       new MidPointSplitPolicy<typename NodeType::sample_point_iterator,
+                                               typename NodeType::value_iterator>()
+                   ),
+                   0,
+                   PointType { -0.5, -0.4 },
+                   PointType { 1.6, 1.7 } );
+
+    auto p_errorIndicator = typename NodeType::error_indicator_ptr(
+        new CellSizeErrorIndicator<typename NodeType::sample_point_iterator,
+                                   typename NodeType::value_iterator>()
+    );
+
+    auto collectLeaves = [&root]() -> std::vector<const NodeType*>
+    {
+        std::vector<const NodeType*> leaves;
+        root.visit( [&leaves]( NodeType* p_node ) { if ( p_node->children().empty() ) leaves.push_back(p_node); return true; } );
+        return leaves;
+    };
+
+    auto countNodes = [&root]() -> Size
+    {
+        Size numberOfNodes = 0;
+        root.visit( [&numberOfNodes]( NodeType* ) { ++numberOfNodes; return true; } );
+        return numberOfNodes;
+    };
+
+    // Extents of the cut leaves above the final level
+    auto cutLeafExtents = [&collectLeaves]() -> std::vector<CoordinateType>
+    {
+        std::vector<CoordinateType> extents;
+        for ( const NodeType* p_leaf : collectLeaves() )
+        {
+            CIE_TEST_REQUIRE( p_leaf->values().size() == p_leaf->sampler()->size() );
+            if ( p_leaf->isBoundary() && p_leaf->level() < depth )
+                extents.push_back( p_leaf->lengths()[0] );
+        }
+        return extents;
+    };
+
+    {
+        CIE_TEST_CASE_INIT( "invalid arguments" )
+
+        CIE_TEST_CHECK_THROWS( root.refine(target, depth, nullptr) );
+        CIE_TEST_CHECK_THROWS( root.refine(target, depth, p_errorIndicator, {.numberOfEvaluations=8}) );
+        CIE_TEST_CHECK_THROWS( root.refine(target, depth, p_errorIndicator, {.numberOfNodes=0}) );
+    }
+
+    // Without a budget, refinement by cell size yields the same tree as divide
+    counter = 0;
+    CIE_TEST_REQUIRE_NOTHROW( root.divide(target, depth) );
+    const Size numberOfEvaluations = counter;
+    const Size numberOfNodes       = countNodes();
+    CIE_TEST_REQUIRE( 1 < numberOfNodes );
+
+    {
+        CIE_TEST_CASE_INIT( "unlimited" )
+
+        counter = 0;
+        typename NodeType::refinement_cost cost;
+        CIE_TEST_REQUIRE_NOTHROW( cost = root.refine(target, depth, p_errorIndicator) );
+        CIE_TEST_CHECK( cost.numberOfEvaluations == counter );
+        CIE_TEST_CHECK( cost.numberOfEvaluations == numberOfEvaluations );
+        CIE_TEST_CHECK( cost.numberOfNodes == numberOfNodes );
+        CIE_TEST_CHECK( countNodes() == numberOfNodes );
+        CIE_TEST_CHECK( cutLeafExtents().empty() );
+    }
+
+    auto checkBudget = [&]( const typename NodeType::refinement_cost& r_budget, bool isBatch ) -> void
+    {
+        counter = 0;
+        typename NodeType::refinement_cost cost;
+
+        if ( isBatch )
+            CIE_TEST_REQUIRE_NOTHROW( cost = root.refine(batchTarget, depth, p_errorIndicator, r_budget) );
+        else
+            CIE_TEST_REQUIRE_NOTHROW( cost = root.refine(target, depth, p_errorIndicator, r_budget) );
+
+        CIE_TEST_CHECK( cost.numberOfEvaluations == counter );
+        CIE_TEST_CHECK( cost.numberOfEvaluations <= r_budget.numberOfEvaluations );
+        CIE_TEST_CHECK( cost.numberOfNodes == countNodes() );
+        CIE_TEST_CHECK( cost.numberOfNodes <= r_budget.numberOfNodes );
+
+        // The budget ran out before the final level
+        CIE_TEST_CHECK( cost.numberOfNodes < numberOfNodes );
+
+        // Largest cut cells are refined first => their sizes differ at most by a factor of 2
+        const auto extents = cutLeafExtents();
+        CIE_TEST_REQUIRE( !extents.empty() );
+        const auto [it_min, it_max] = std::minmax_element( extents.begin(), extents.end() );
+        CIE_TEST_CHECK( *it_max <= 2 * (*it_min) * (1 + 1e-10) );
+    };
+
+    {
+        CIE_TEST_CASE_INIT( "evaluation budget" )
+
+        checkBudget( {.numberOfEvaluations = numberOfEvaluations / 3}, false );
+        const Size pointWiseNumberOfNodes = countNodes();
+
+        // Point-wise and batch targets refine the same cells
+        checkBudget( {.numberOfEvaluations = numberOfEvaluations / 3}, true );
+        CIE_TEST_CHECK( countNodes() == pointWiseNumberOfNodes );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "node budget" )
+
+        checkBudget( {.numberOfNodes = numberOfNodes / 2}, false );
+        checkBudget( {.numberOfNodes = 3}, true );
+        CIE_TEST_CHECK( countNodes() == 1 );
+    }
+}
+
+
 } // namespace cie::csg
@@ -0,0 +1,121 @@
+// --- Utility Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+
+// --- Internal Includes ---
+#include "CSG/packages/trees/inc/ValueStore.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <algorithm>
+#include <set>
+#include <thread>
+
+
+namespace cie::csg {
+
+
+CIE_TEST_CASE( "ValueStore", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "ValueStore" )
+
+    CIE_TEST_CHECK_THROWS( ValueStore<Double>(0) );
+    CIE_TEST_CHECK_THROWS( ValueStore<Double>(1, 0) );
+
+    const Size sliceSize = 5;
+    const Size blockSize = 4;
+    ValueStore<Double> store( sliceSize, blockSize );
+
+    CIE_TEST_CHECK( store.sliceSize() == sliceSize );
+    CIE_TEST_CHECK( store.size() == 0 );
+    CIE_TEST_CHECK( store.capacity() == 0 );
+
+    // Slices are disjoint
+    std::vector<Double*> slices;
+    for ( Size i=0; i<10; ++i )
+    {
+        slices.push_back( store.allocate() );
+        std::fill( slices.back(), slices.back() + sliceSize, Double(i) );
+    }
+
+    CIE_TEST_CHECK( store.size() == 10 );
+    CIE_TEST_CHECK( store.capacity() == 12 );
+
+    for ( Size i=0; i<slices.size(); ++i )
+        CIE_TEST_CHECK( std::all_of(slices[i], slices[i] + sliceSize, [i](Double value) { return value == Double(i); }) );
+
+    // Slices of a block are contiguous
+    for ( Size i=1; i<blockSize; ++i )
+        CIE_TEST_CHECK( slices[i] == slices[i-1] + sliceSize );
+
+    // Released slices are reused
+    CIE_TEST_CHECK_NOTHROW( store.release(nullptr) );
+    CIE_TEST_CHECK_NOTHROW( store.release(slices[3]) );
+    CIE_TEST_CHECK_NOTHROW( store.release(slices[7]) );
+    CIE_TEST_CHECK( store.size() == 8 );
+
+    const std::set<Double*> released = { slices[3], slices[7] };
+    CIE_TEST_CHECK( released.contains(store.allocate()) );
+    CIE_TEST_CHECK( released.contains(store.allocate()) );
+    CIE_TEST_CHECK( store.size() == 10 );
+    CIE_TEST_CHECK( store.capacity() == 12 );
+}
+
+
+CIE_TEST_CASE( "ValueStore concurrent", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "ValueStore concurrent" )
+
+    CIE_TEST_CHECK( ValueStore<Double>(1, 1, 5).numberOfShards() == 8 );
+
+    const Size sliceSize       = 3;
+    const Size numberOfThreads = 4;
+    const Size numberOfSlices  = 1000;
+    ValueStore<Double> store( sliceSize, 16, 2 );
+
+    // Threads allocate, fill, and release slices of their own and each other's
+    std::vector<std::vector<Double*>> slices( numberOfThreads );
+    std::vector<std::thread> threads;
+    for ( Size i_thread=0; i_thread<numberOfThreads; ++i_thread )
+        threads.emplace_back( [&store, &slices, i_thread]()
+        {
+            auto& r_slices = slices[i_thread];
+            for ( Size i=0; i<numberOfSlices; ++i )
+            {
+                r_slices.push_back( store.allocate() );
+                std::fill( r_slices.back(), r_slices.back() + sliceSize, Double(i_thread) );
+                if ( i % 3 == 0 )
+                {
+                    store.release( r_slices.back() );
+                    r_slices.pop_back();
+                }
+            }
+        } );
+
+    for ( auto& r_thread : threads )
+        r_thread.join();
+
+    std::set<Double*> allSlices;
+    for ( Size i_thread=0; i_thread<numberOfThreads; ++i_thread )
+        for ( Double* p_slice : slices[i_thread] )
+        {
+            CIE_TEST_CHECK( std::all_of(p_slice, p_slice + sliceSize, [i_thread](Double value) { return value == Double(i_thread); }) );
+            allSlices.insert( p_slice );
+        }
+
+    Size numberOfLiveSlices = 0;
+    for ( const auto& r_slices : slices )
+        numberOfLiveSlices += r_slices.size();
+
+    CIE_TEST_CHECK( allSlices.size() == numberOfLiveSlices );
+    CIE_TEST_CHECK( store.size() == numberOfLiveSlices );
+    CIE_TEST_CHECK( numberOfLiveSlices <= store.capacity() );
+
+    // Release everything from a single thread
+    for ( Double* p_slice : allSlices )
+        store.release( p_slice );
+
+    CIE_TEST_CHECK( store.size() == 0 );
+}
+
+
+} // namespace cie::csg
\ No newline at end of file
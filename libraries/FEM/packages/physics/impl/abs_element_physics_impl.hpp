@@ -5,19 +5,6 @@
 namespace cie::fem {
 
 
-template <  concepts::STLContainer NestedContainer,
-            concepts::STLContainer StoredType >
-requires concepts::STLContainer<typename NestedContainer::value_type>
-inline Size
-NestedCache<NestedContainer,StoredType>::hash( const NestedContainer& container ) const
-{
-    Size seed = container.size();
-    for ( auto it=container.begin(); it!=container.end(); it++ )
-        seed ^= Size(&(*it)) + 0x9e3779b9 + (seed<<6) + (seed>>2);
-    return seed;
-}
-
-
 template <class ElementType>
 template <class ...Args>
 AbsElementPhysics<ElementType>::AbsElementPhysics( Args&&... elementArgs ) :
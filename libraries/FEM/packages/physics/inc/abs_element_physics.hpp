@@ -18,14 +18,15 @@
 namespace cie::fem {
 
 
-// Specialized cache that can hash a container of points
+// Specialized cache that can hash a container of points (by their coordinates)
 template <  concepts::STLContainer NestedContainer,
-            concepts::STLContainer StoredType >
+            concepts::STLContainer StoredType,
+            class EvictionPolicy = cie::utils::NoEviction >
 requires concepts::STLContainer<typename NestedContainer::value_type>
-class NestedCache : public cie::utils::ContainerCache<NestedContainer,StoredType>
+class NestedCache : public cie::utils::ContainerCache<NestedContainer,StoredType,EvictionPolicy>
 {
 public:
-    virtual Size hash( const NestedContainer& container ) const override;
+    using cie::utils::ContainerCache<NestedContainer,StoredType,EvictionPolicy>::ContainerCache;
 };
 
 
@@ -2,5 +2,6 @@
 #define CIE_CIEUTILS_CACHE_EXPORT_HPP
 
 #include "cieutils/packages/cache/inc/cache.hpp"
+#include "cieutils/packages/cache/inc/concurrent_cache.hpp"
 
 #endif
\ No newline at end of file
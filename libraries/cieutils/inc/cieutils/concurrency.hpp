@@ -2,8 +2,13 @@
 #define CIE_UTILS_CONCURRENCY_HPP_EXPORT
 
 
+#include "cieutils/packages/concurrency/inc/Task.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadAffinity.hpp"
 #include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolStatistics.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolSingleton.hpp"
 #include "cieutils/packages/concurrency/inc/ParallelFor.hpp"
+#include "cieutils/packages/concurrency/inc/ConcurrentHashMap.hpp"
 
 
 #endif
\ No newline at end of file
@@ -3,5 +3,6 @@
 
 #include "cieutils/packages/output/inc/fileinfo.hpp"
 #include "cieutils/packages/output/inc/FileManager.hpp"
+#include "cieutils/packages/output/inc/MappedFile.hpp"
 
 #endif
\ No newline at end of file
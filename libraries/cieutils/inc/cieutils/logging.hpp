@@ -5,5 +5,6 @@
 #include "cieutils/packages/logging/inc/Loggee.hpp"
 #include "cieutils/packages/logging/inc/Logger.hpp"
 #include "cieutils/packages/logging/inc/LoggerSingleton.hpp"
+#include "cieutils/packages/logging/inc/Profiler.hpp"
 
 #endif
\ No newline at end of file
@@ -5,5 +5,6 @@
 #include "cieutils/packages/stl_extension/inc/state_iterator.hpp"
 #include "cieutils/packages/stl_extension/inc/resize.hpp"
 #include "cieutils/packages/stl_extension/inc/make_shared_from_tuple.hpp"
+#include "cieutils/packages/stl_extension/inc/hash.hpp"
 
 #endif
\ No newline at end of file
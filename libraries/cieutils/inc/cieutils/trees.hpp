@@ -2,5 +2,6 @@
 #define CIE_CIEUTILS_ABS_TREE_HPP_EXPORT
 
 #include "cieutils/packages/trees/inc/abstree.hpp"
+#include "cieutils/packages/trees/inc/FlatTree.hpp"
 
 #endif
\ No newline at end of file
@@ -4,17 +4,56 @@
 // --- Internal Includes ---
 #include "cieutils/packages/macros/inc/exceptions.hpp"
 #include "cieutils/packages/macros/inc/assertions.hpp"
+#include "cieutils/packages/macros/inc/checks.hpp"
 
 
 namespace cie::utils {
 
 
+inline double CacheStatistics::hitRate() const
+{
+    const Size lookups = this->hits + this->misses;
+    return lookups ? double(this->hits) / double(lookups) : 0.0;
+}
+
+
+template <class StoredType>
+inline Size cacheByteSize( const StoredType& r_value )
+{
+    if constexpr ( concepts::STLContainer<StoredType> )
+        return sizeof(StoredType) + r_value.size() * sizeof(typename StoredType::value_type);
+    else
+        return sizeof(StoredType);
+}
+
+
 template <  class InputType,
-            class StoredType >
-inline typename AbsCache<InputType,StoredType>::internal_iterator
-AbsCache<InputType,StoredType>::insert( const InputType& input,
-                                        typename AbsCache::generator_function generator,
-                                        bool force )
+            class StoredType,
+            class EvictionPolicy >
+AbsCache<InputType,StoredType,EvictionPolicy>::AbsCache( Size maxEntries,
+                                                        Size maxBytes,
+                                                        typename AbsCache::size_function sizeFunction )
+requires (bounded)
+    : _maxEntries( maxEntries ),
+      _maxBytes( maxBytes ),
+      _sizeFunction( sizeFunction )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK( 0 < maxEntries, "A bounded cache must be able to hold at least one entry" )
+    CIE_CHECK_POINTER( sizeFunction )
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType,
+            class EvictionPolicy >
+inline typename AbsCache<InputType,StoredType,EvictionPolicy>::internal_iterator
+AbsCache<InputType,StoredType,EvictionPolicy>::insert( const InputType& input,
+                                                       typename AbsCache::generator_function generator,
+                                                       bool force )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
@@ -23,9 +62,28 @@ AbsCache<InputType,StoredType>::insert( const InputType& input,
     auto mapIt  = _map.find(id);
 
     if (mapIt == _map.end())
-        mapIt = _map.emplace( id, generator(input) ).first;
-    else if ( force )
-        mapIt->second = generator(input);
+    {
+        ++_statistics.misses;
+        return this->emplace( id, generator(input) );
+    }
+
+    ++_statistics.hits;
+
+    if ( force )
+    {
+        if constexpr ( bounded )
+        {
+            // Reinsert, the new value may have a different size
+            StoredType value = generator(input);
+            this->unregister( mapIt );
+            _map.erase( mapIt );
+            return this->emplace( id, std::move(value) );
+        }
+        else
+            mapIt->second = generator(input);
+    }
+    else if constexpr ( bounded )
+        _policy.touch( id );
 
     return mapIt;
 
@@ -34,11 +92,12 @@ AbsCache<InputType,StoredType>::insert( const InputType& input,
 
 
 template <  class InputType,
-            class StoredType >
-inline typename AbsCache<InputType,StoredType>::internal_iterator
-AbsCache<InputType,StoredType>::insert( const InputType& input,
-                                        const StoredType& value,
-                                        bool force )
+            class StoredType,
+            class EvictionPolicy >
+inline typename AbsCache<InputType,StoredType,EvictionPolicy>::internal_iterator
+AbsCache<InputType,StoredType,EvictionPolicy>::insert( const InputType& input,
+                                                       const StoredType& value,
+                                                       bool force )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
@@ -47,9 +106,27 @@ AbsCache<InputType,StoredType>::insert( const InputType& input,
     auto mapIt  = _map.find(id);
 
     if (mapIt == _map.end())
-        mapIt = _map.emplace( id, value ).first;
-    else if ( force )
-        mapIt->second = value;
+    {
+        ++_statistics.misses;
+        return this->emplace( id, StoredType(value) );
+    }
+
+    ++_statistics.hits;
+
+    if ( force )
+    {
+        if constexpr ( bounded )
+        {
+            // Reinsert, the new value may have a different size
+            this->unregister( mapIt );
+            _map.erase( mapIt );
+            return this->emplace( id, StoredType(value) );
+        }
+        else
+            mapIt->second = value;
+    }
+    else if constexpr ( bounded )
+        _policy.touch( id );
 
     return mapIt;
 
@@ -58,20 +135,27 @@ AbsCache<InputType,StoredType>::insert( const InputType& input,
 
 
 template <  class InputType,
-            class StoredType >
-inline const typename AbsCache<InputType,StoredType>::stored_type&
-AbsCache<InputType,StoredType>::operator[]( Size inputID ) const
+            class StoredType,
+            class EvictionPolicy >
+inline const typename AbsCache<InputType,StoredType,EvictionPolicy>::stored_type&
+AbsCache<InputType,StoredType,EvictionPolicy>::operator[]( Size inputID ) const
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
     auto mapIt = _map.find(inputID);
     if (mapIt == _map.end())
     {
+        ++_statistics.misses;
         CIE_THROW(
             OutOfRangeException,
             "Input with ID " + std::to_string(inputID) + " does not have a recorded value in the cache"
         )
     }
+
+    ++_statistics.hits;
+    if constexpr ( bounded )
+        _policy.touch( inputID );
+
     return mapIt->second;
 
     CIE_END_EXCEPTION_TRACING
@@ -79,9 +163,10 @@ AbsCache<InputType,StoredType>::operator[]( Size inputID ) const
 
 
 template <  class InputType,
-            class StoredType >
-inline const typename AbsCache<InputType,StoredType>::stored_type&
-AbsCache<InputType,StoredType>::operator[]( const InputType& input ) const
+            class StoredType,
+            class EvictionPolicy >
+inline const typename AbsCache<InputType,StoredType,EvictionPolicy>::stored_type&
+AbsCache<InputType,StoredType,EvictionPolicy>::operator[]( const InputType& input ) const
 {
     CIE_BEGIN_EXCEPTION_TRACING
     return this->operator[]( this->hash(input) );
@@ -90,9 +175,10 @@ AbsCache<InputType,StoredType>::operator[]( const InputType& input ) const
 
 
 template <  class InputType,
-            class StoredType >
+            class StoredType,
+            class EvictionPolicy >
 inline bool
-AbsCache<InputType,StoredType>::cached( Size id ) const
+AbsCache<InputType,StoredType,EvictionPolicy>::cached( Size id ) const
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
@@ -105,9 +191,10 @@ AbsCache<InputType,StoredType>::cached( Size id ) const
 
 
 template <  class InputType,
-            class StoredType >
+            class StoredType,
+            class EvictionPolicy >
 inline bool
-AbsCache<InputType,StoredType>::cached( const InputType& input ) const
+AbsCache<InputType,StoredType,EvictionPolicy>::cached( const InputType& input ) const
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
@@ -118,31 +205,110 @@ AbsCache<InputType,StoredType>::cached( const InputType& input ) const
 
 
 template <  class InputType,
-            class StoredType >
+            class StoredType,
+            class EvictionPolicy >
 inline void
-AbsCache<InputType,StoredType>::erase( Size id )
+AbsCache<InputType,StoredType,EvictionPolicy>::erase( Size id )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
     auto mapIt = _map.find(id);
     if (mapIt != _map.end())
+    {
+        this->unregister( mapIt );
         _map.erase(mapIt);
+    }
 
     CIE_END_EXCEPTION_TRACING
 }
 
 
+template <  class InputType,
+            class StoredType,
+            class EvictionPolicy >
+inline void
+AbsCache<InputType,StoredType,EvictionPolicy>::clear()
+{
+    _map.clear();
+    _bytes = 0;
+
+    if constexpr ( bounded )
+        _policy.clear();
+}
+
+
+template <  class InputType,
+            class StoredType,
+            class EvictionPolicy >
+inline typename AbsCache<InputType,StoredType,EvictionPolicy>::internal_iterator
+AbsCache<InputType,StoredType,EvictionPolicy>::emplace( Size id, StoredType&& r_value )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if constexpr ( bounded )
+    {
+        const Size newBytes = _sizeFunction( r_value );
+        this->makeRoom( newBytes );
+
+        auto mapIt = _map.emplace( id, std::move(r_value) ).first;
+        _bytes += newBytes;
+        _policy.insert( id );
+        return mapIt;
+    }
+    else
+        return _map.emplace( id, std::move(r_value) ).first;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType,
+            class EvictionPolicy >
+inline void
+AbsCache<InputType,StoredType,EvictionPolicy>::makeRoom( Size newBytes )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    while ( !_map.empty()
+            && ( _maxEntries <= _map.size() || _maxBytes < newBytes || _maxBytes - newBytes < _bytes ) )
+    {
+        auto mapIt = _map.find( _policy.victim() );
+        CIE_OUT_OF_RANGE_CHECK( mapIt != _map.end() )
+
+        this->unregister( mapIt );
+        _map.erase( mapIt );
+        ++_statistics.evictions;
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType,
+            class EvictionPolicy >
+inline void
+AbsCache<InputType,StoredType,EvictionPolicy>::unregister( typename AbsCache::internal_iterator it_entry )
+{
+    if constexpr ( bounded )
+    {
+        _bytes -= _sizeFunction( it_entry->second );
+        _policy.erase( it_entry->first );
+    }
+}
+
+
 template <  concepts::STLContainer InputContainer,
-            concepts::STLContainer OutputContainer >
+            concepts::STLContainer OutputContainer,
+            class EvictionPolicy,
+            class HashType >
 inline Size
-ContainerCache<InputContainer,OutputContainer>::hash( const InputContainer& container ) const
+ContainerCache<InputContainer,OutputContainer,EvictionPolicy,HashType>::hash( const InputContainer& container ) const
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    Size seed = container.size();
-    for ( auto it=container.begin(); it!=container.end(); it++ )
-        seed ^= Size(&(*it)) + 0x9e3779b9 + (seed<<6) + (seed>>2);
-    return seed;
+    return _hasher( container );
 
     CIE_END_EXCEPTION_TRACING
 }
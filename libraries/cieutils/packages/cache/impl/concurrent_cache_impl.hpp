@@ -0,0 +1,228 @@
+#ifndef CIE_UTILITIES_CONCURRENT_CACHE_IMPL_HPP
+#define CIE_UTILITIES_CONCURRENT_CACHE_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <chrono>
+
+
+namespace cie::utils {
+
+
+template <  class InputType,
+            class StoredType >
+ConcurrentCache<InputType,StoredType>::ConcurrentCache( Size numberOfShards ) :
+    _map( numberOfShards ),
+    _tickets( 0 ),
+    _hits( 0 ),
+    _misses( 0 )
+{
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline typename ConcurrentCache<InputType,StoredType>::value_pointer
+ConcurrentCache<InputType,StoredType>::insert( const InputType& input,
+                                               typename ConcurrentCache::generator_function generator,
+                                               bool force )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->getOrGenerate(
+        this->hash(input),
+        [&input, &generator]() { return std::make_shared<const StoredType>( generator(input) ); },
+        force
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline typename ConcurrentCache<InputType,StoredType>::value_pointer
+ConcurrentCache<InputType,StoredType>::insert( const InputType& input,
+                                               const StoredType& value,
+                                               bool force )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->getOrGenerate(
+        this->hash(input),
+        [&value]() { return std::make_shared<const StoredType>( value ); },
+        force
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline typename ConcurrentCache<InputType,StoredType>::value_pointer
+ConcurrentCache<InputType,StoredType>::operator[]( Size inputID ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    auto o_entry = _map.find( inputID );
+    if ( !o_entry )
+    {
+        ++_misses;
+        CIE_THROW(
+            OutOfRangeException,
+            "Input with ID " + std::to_string(inputID) + " does not have a recorded value in the cache"
+        )
+    }
+
+    ++_hits;
+    return o_entry->future.get();
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline typename ConcurrentCache<InputType,StoredType>::value_pointer
+ConcurrentCache<InputType,StoredType>::operator[]( const InputType& input ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    return this->operator[]( this->hash(input) );
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline bool
+ConcurrentCache<InputType,StoredType>::cached( Size id ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    auto o_entry = _map.find( id );
+    return o_entry && o_entry->future.wait_for( std::chrono::seconds(0) ) == std::future_status::ready;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline bool
+ConcurrentCache<InputType,StoredType>::cached( const InputType& input ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    return this->cached( this->hash(input) );
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline void
+ConcurrentCache<InputType,StoredType>::erase( Size id )
+{
+    _map.erase( id );
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline CacheStatistics
+ConcurrentCache<InputType,StoredType>::statistics() const
+{
+    CacheStatistics statistics;
+    statistics.hits   = _hits.load( std::memory_order_relaxed );
+    statistics.misses = _misses.load( std::memory_order_relaxed );
+    return statistics;
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline void
+ConcurrentCache<InputType,StoredType>::resetStatistics()
+{
+    _hits.store( 0, std::memory_order_relaxed );
+    _misses.store( 0, std::memory_order_relaxed );
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline typename ConcurrentCache<InputType,StoredType>::value_pointer
+ConcurrentCache<InputType,StoredType>::generate( Size id,
+                                                 Size ticket,
+                                                 std::promise<typename ConcurrentCache::value_pointer>& r_promise,
+                                                 const std::function<typename ConcurrentCache::value_pointer()>& r_generator )
+{
+    try
+    {
+        auto p_value = r_generator();
+        r_promise.set_value( p_value );
+        return p_value;
+    }
+    catch ( ... )
+    {
+        // Forward the exception to waiting threads and let the next request retry
+        // (unless the entry was replaced by a forced request in the meantime)
+        r_promise.set_exception( std::current_exception() );
+        _map.eraseIf( id, [ticket]( const Entry& r_entry ) { return r_entry.ticket == ticket; } );
+        throw;
+    }
+}
+
+
+template <  class InputType,
+            class StoredType >
+inline typename ConcurrentCache<InputType,StoredType>::value_pointer
+ConcurrentCache<InputType,StoredType>::getOrGenerate( Size id,
+                                                      const std::function<typename ConcurrentCache::value_pointer()>& r_generator,
+                                                      bool force )
+{
+    std::promise<value_pointer> promise;
+    const Entry entry { promise.get_future().share(), _tickets++ };
+
+    if ( force )
+        _map.insertOrAssign( id, entry );
+    else
+    {
+        // Either find an existing entry or claim the id by inserting
+        // this thread's future (retry if the entry gets erased in between)
+        while ( true )
+        {
+            if ( auto o_entry = _map.find(id); o_entry )
+            {
+                ++_hits;
+                return o_entry->future.get();
+            }
+
+            if ( _map.emplace(id, entry) )
+                break;
+        }
+    }
+
+    ++_misses;
+    return this->generate( id, entry.ticket, promise, r_generator );
+}
+
+
+template <  concepts::STLContainer InputContainer,
+            concepts::STLContainer OutputContainer,
+            class HashType >
+inline Size
+ConcurrentContainerCache<InputContainer,OutputContainer,HashType>::hash( const InputContainer& container ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    return _hasher( container );
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+} // namespace cie::utils
+
+
+#endif
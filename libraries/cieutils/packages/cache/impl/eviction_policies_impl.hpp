@@ -0,0 +1,103 @@
+#ifndef CIE_UTILITIES_CACHE_EVICTION_POLICIES_IMPL_HPP
+#define CIE_UTILITIES_CACHE_EVICTION_POLICIES_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/assertions.hpp"
+
+
+namespace cie::utils {
+
+
+/* --- LRUEviction --- */
+
+inline void LRUEviction::insert( Size id )
+{
+    this->_order.push_front( id );
+    this->_positions[id] = this->_order.begin();
+}
+
+
+inline void LRUEviction::touch( Size id )
+{
+    auto it = this->_positions.find( id );
+    if ( it != this->_positions.end() )
+        this->_order.splice( this->_order.begin(), this->_order, it->second );
+}
+
+
+inline void LRUEviction::erase( Size id )
+{
+    auto it = this->_positions.find( id );
+    if ( it != this->_positions.end() )
+    {
+        this->_order.erase( it->second );
+        this->_positions.erase( it );
+    }
+}
+
+
+inline void LRUEviction::clear()
+{
+    this->_order.clear();
+    this->_positions.clear();
+}
+
+
+inline Size LRUEviction::victim() const
+{
+    CIE_ASSERT( !this->_order.empty(), "No entries to evict" )
+    return this->_order.back();
+}
+
+
+/* --- LFUEviction --- */
+
+inline void LFUEviction::insert( Size id )
+{
+    const key_type key { 1, this->_time++, id };
+    this->_order.insert( key );
+    this->_keys[id] = key;
+}
+
+
+inline void LFUEviction::touch( Size id )
+{
+    auto it = this->_keys.find( id );
+    if ( it != this->_keys.end() )
+    {
+        this->_order.erase( it->second );
+        it->second = key_type( std::get<0>(it->second) + 1, this->_time++, id );
+        this->_order.insert( it->second );
+    }
+}
+
+
+inline void LFUEviction::erase( Size id )
+{
+    auto it = this->_keys.find( id );
+    if ( it != this->_keys.end() )
+    {
+        this->_order.erase( it->second );
+        this->_keys.erase( it );
+    }
+}
+
+
+inline void LFUEviction::clear()
+{
+    this->_order.clear();
+    this->_keys.clear();
+}
+
+
+inline Size LFUEviction::victim() const
+{
+    CIE_ASSERT( !this->_order.empty(), "No entries to evict" )
+    return std::get<2>( *this->_order.begin() );
+}
+
+
+} // namespace cie::utils
+
+
+#endif
@@ -4,27 +4,69 @@
 // --- Ínternal Includes ---
 #include "cieutils/packages/types/inc/types.hpp"
 #include "cieutils/packages/concepts/inc/container_concepts.hpp"
+#include "cieutils/packages/cache/inc/eviction_policies.hpp"
+#include "cieutils/packages/stl_extension/inc/hash.hpp"
 
 // --- STL Includes ---
 #include <unordered_map>
 #include <functional>
+#include <limits>
 
 
 namespace cie::utils {
 
 
+/// Lookup counters of a cache
+struct CacheStatistics
+{
+    Size hits      = 0;
+    Size misses    = 0;
+    Size evictions = 0;
+
+    double hitRate() const;
+};
+
+
+/// Estimated memory footprint of a cached value (containers include their elements)
+template <class StoredType>
+Size cacheByteSize( const StoredType& r_value );
+
+
+/**
+ * @brief Map of values generated from inputs, identified by the hashes of the inputs.
+ * The cache is unbounded by default. Caches with an eviction policy (see LRUEviction
+ * and LFUEviction) can be limited by the number of stored entries and/or their total
+ * size in bytes, and evict entries chosen by the policy to make room for new ones.
+ * @note an entry larger than the byte budget is still stored (after evicting all others).
+ * @note inserting into a bounded cache can invalidate previously returned iterators.
+ */
 template <  class InputType,
-            class StoredType >
+            class StoredType,
+            class EvictionPolicy = NoEviction >
 class AbsCache
 {
 public:
     using input_type            = InputType;
     using stored_type           = StoredType;
+    using eviction_policy       = EvictionPolicy;
     using internal_type         = std::unordered_map<Size,StoredType>;
     using internal_iterator     = typename internal_type::const_iterator;
     using generator_function    = std::function<stored_type(const input_type&)>;
+    using size_function         = std::function<Size(const stored_type&)>;
+
+    static constexpr bool bounded = !std::is_same_v<EvictionPolicy,NoEviction>;
 
 public:
+    AbsCache() = default;
+
+    /// Bounded cache holding at most 'maxEntries' values that take up at most 'maxBytes' bytes
+    AbsCache( Size maxEntries,
+              Size maxBytes = std::numeric_limits<Size>::max(),
+              size_function sizeFunction = cacheByteSize<StoredType> )
+    requires (bounded);
+
+    virtual ~AbsCache() = default;
+
     virtual Size hash( const input_type& input ) const = 0;
     internal_iterator insert(   const input_type& input,
                                 generator_function generator,
@@ -39,22 +81,72 @@ public:
     bool cached( const InputType& input ) const;
 
     void erase( Size id );
-    void clear()                                                { _map.clear(); }
+    void clear();
     Size size() const                                           { return _map.size(); }
     internal_iterator begin() const                             { return _map.begin(); }
     internal_iterator end() const                               { return _map.end(); }
 
+    /// Max number of entries
+    Size maxEntries() const                                     { return _maxEntries; }
+    /// Max total size of the entries in bytes
+    Size maxBytes() const                                       { return _maxBytes; }
+    /// Total size of the entries in bytes (only tracked by bounded caches)
+    Size bytes() const                                          { return _bytes; }
+
+    const CacheStatistics& statistics() const                   { return _statistics; }
+    void resetStatistics()                                      { _statistics = CacheStatistics(); }
+
 protected:
     internal_type   _map;
+
+private:
+    /// Store a value that is not in the cache yet, evicting entries if necessary
+    internal_iterator emplace( Size id, StoredType&& r_value );
+
+    /// Evict entries until a new one with the specified size fits in the cache
+    void makeRoom( Size newBytes );
+
+    /// Update the size and policy after removing an entry
+    void unregister( internal_iterator it_entry );
+
+private:
+    Size                        _maxEntries = std::numeric_limits<Size>::max();
+    Size                        _maxBytes   = std::numeric_limits<Size>::max();
+    Size                        _bytes      = 0;
+    size_function               _sizeFunction;
+    mutable EvictionPolicy      _policy;
+    mutable CacheStatistics     _statistics;
 };
 
 
+/**
+ * @brief Cache with container inputs, identified by their contents.
+ * The hash policy defaults to exact content hashing (ContainerHash); floating
+ * point inputs can be matched approximately with QuantizedContainerHash.
+ */
 template <  concepts::STLContainer InputContainer,
-            concepts::STLContainer OutputContainer>
-class ContainerCache : public AbsCache<InputContainer,OutputContainer>
+            concepts::STLContainer OutputContainer,
+            class EvictionPolicy = NoEviction,
+            class HashType = ContainerHash >
+class ContainerCache : public AbsCache<InputContainer,OutputContainer,EvictionPolicy>
 {
 public:
+    using AbsCache<InputContainer,OutputContainer,EvictionPolicy>::AbsCache;
+
+    /// Construct with a custom hasher, forward the rest of the arguments to AbsCache
+    template <class ...Args>
+    ContainerCache( const HashType& r_hasher, Args&&... r_args )
+        : AbsCache<InputContainer,OutputContainer,EvictionPolicy>( std::forward<Args>(r_args)... ),
+          _hasher( r_hasher )
+    {}
+
     virtual Size hash( const InputContainer& input) const override;
+
+    const HashType& hasher() const
+    { return _hasher; }
+
+private:
+    HashType _hasher;
 };
 
 
@@ -62,4 +154,4 @@ public:
 
 #include "cieutils/packages/cache/impl/cache_impl.hpp"
 
-#endif
\ No newline at end of file
+#endif
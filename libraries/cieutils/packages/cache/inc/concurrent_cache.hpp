@@ -0,0 +1,126 @@
+#ifndef CIE_UTILITIES_CONCURRENT_CACHE_HPP
+#define CIE_UTILITIES_CONCURRENT_CACHE_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+#include "cieutils/packages/cache/inc/cache.hpp"
+#include "cieutils/packages/concurrency/inc/ConcurrentHashMap.hpp"
+
+// --- STL Includes ---
+#include <functional>
+#include <future>
+#include <memory>
+#include <atomic>
+
+
+namespace cie::utils {
+
+
+/**
+ * @brief Thread-safe counterpart of AbsCache, backed by a sharded mp::ConcurrentHashMap.
+ * If several threads request the same missing input at once, the value is generated
+ * only by the first one and the others wait for its result. Generators run without
+ * holding any locks, so they may themselves access the cache.
+ * @note values are shared through pointers to const, which stay valid even if the
+ * entry is erased from the cache in the meantime.
+ * @note if a generator throws, the exception is forwarded to every thread waiting for
+ * the value, and the entry is removed so that the next request tries again.
+ */
+template <  class InputType,
+            class StoredType >
+class ConcurrentCache
+{
+public:
+    using input_type            = InputType;
+    using stored_type           = StoredType;
+    using value_pointer         = std::shared_ptr<const StoredType>;
+    using generator_function    = std::function<stored_type(const input_type&)>;
+
+public:
+    ConcurrentCache( Size numberOfShards = 64 );
+
+    virtual ~ConcurrentCache() = default;
+
+    virtual Size hash( const input_type& input ) const = 0;
+
+    /// Get the cached value of an input, or generate and store it if it's not cached yet
+    value_pointer insert(   const input_type& input,
+                            generator_function generator,
+                            bool force = false );
+
+    value_pointer insert(   const input_type& input,
+                            const StoredType& value,
+                            bool force = false );
+
+    /// Get a cached value (blocks if it's being generated), throws if it's not in the cache
+    value_pointer operator[]( Size inputID ) const;
+    value_pointer operator[]( const input_type& input ) const;
+
+    /// Check whether a value is stored and ready (values being generated don't count)
+    bool cached( Size id ) const;
+    bool cached( const InputType& input ) const;
+
+    void erase( Size id );
+    void clear()                                                { _map.clear(); }
+    Size size() const                                           { return _map.size(); }
+
+    CacheStatistics statistics() const;
+    void resetStatistics();
+
+private:
+    using future_type = std::shared_future<value_pointer>;
+
+    /// Futures are not comparable => entries are told apart by a ticket
+    struct Entry
+    {
+        future_type future;
+        Size        ticket;
+    };
+
+    /// Generate a value into the promise of an entry owned by the calling thread
+    value_pointer generate( Size id,
+                            Size ticket,
+                            std::promise<value_pointer>& r_promise,
+                            const std::function<value_pointer()>& r_generator );
+
+    /// Get the value of an existing entry or generate it if there is none
+    value_pointer getOrGenerate( Size id,
+                                 const std::function<value_pointer()>& r_generator,
+                                 bool force );
+
+private:
+    mp::ConcurrentHashMap<Size,Entry>       _map;
+    std::atomic<Size>                       _tickets;
+    mutable std::atomic<Size>               _hits;
+    mutable std::atomic<Size>               _misses;
+};
+
+
+/// Thread-safe counterpart of ContainerCache
+template <  concepts::STLContainer InputContainer,
+            concepts::STLContainer OutputContainer,
+            class HashType = ContainerHash >
+class ConcurrentContainerCache : public ConcurrentCache<InputContainer,OutputContainer>
+{
+public:
+    ConcurrentContainerCache( Size numberOfShards = 64,
+                              const HashType& r_hasher = HashType() )
+        : ConcurrentCache<InputContainer,OutputContainer>( numberOfShards ),
+          _hasher( r_hasher )
+    {}
+
+    virtual Size hash( const InputContainer& input ) const override;
+
+    const HashType& hasher() const
+    { return _hasher; }
+
+private:
+    HashType _hasher;
+};
+
+
+} // namespace cie::utils
+
+#include "cieutils/packages/cache/impl/concurrent_cache_impl.hpp"
+
+#endif
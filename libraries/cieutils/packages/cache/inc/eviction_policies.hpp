@@ -0,0 +1,80 @@
+#ifndef CIE_UTILITIES_CACHE_EVICTION_POLICIES_HPP
+#define CIE_UTILITIES_CACHE_EVICTION_POLICIES_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <unordered_map>
+#include <list>
+#include <set>
+#include <tuple>
+
+
+namespace cie::utils {
+
+
+/**
+ * @brief Default policy of AbsCache: entries are never evicted, the cache is unbounded.
+ * Bounded caches require a policy that provides
+ *  - insert( id ): register a new entry
+ *  - touch( id ):  register an access to an existing entry
+ *  - erase( id ):  unregister an entry
+ *  - clear():      unregister all entries
+ *  - victim():     id of the entry to evict next (only called if there are entries)
+ */
+struct NoEviction {};
+
+
+/// Evict the least recently used entry
+class LRUEviction
+{
+public:
+    void insert( Size id );
+
+    void touch( Size id );
+
+    void erase( Size id );
+
+    void clear();
+
+    Size victim() const;
+
+private:
+    using order_container = std::list<Size>;
+
+    /// Entry ids, most recently used first
+    order_container                                         _order;
+    std::unordered_map<Size,order_container::iterator>      _positions;
+};
+
+
+/// Evict the least frequently used entry (ties are broken by recency)
+class LFUEviction
+{
+public:
+    void insert( Size id );
+
+    void touch( Size id );
+
+    void erase( Size id );
+
+    void clear();
+
+    Size victim() const;
+
+private:
+    /// {number of accesses, time of last access, id}
+    using key_type = std::tuple<Size,Size,Size>;
+
+    std::set<key_type>                  _order;
+    std::unordered_map<Size,key_type>   _keys;
+    Size                                _time = 0;
+};
+
+
+} // namespace cie::utils
+
+#include "cieutils/packages/cache/impl/eviction_policies_impl.hpp"
+
+#endif
@@ -5,6 +5,7 @@
 // --- STL Includes ---
 #include <vector>
 #include <array>
+#include <memory>
 
 
 namespace cie::utils
@@ -61,5 +62,173 @@ CIE_TEST_CASE( "ContainerCache", "[cache]" )
     }
 }
 
+CIE_TEST_CASE( "ContainerCache - content hashing", "[cache]" )
+{
+    CIE_TEST_CASE_INIT( "ContainerCache - content hashing" )
+
+    using PointSet = std::vector<std::array<double,2>>;
+    auto generator = []( const PointSet& r_points ) { return std::vector<double>( r_points.size(), 1.0 ); };
+
+    {
+        CIE_TEST_CASE_INIT( "exact" )
+
+        ContainerCache<PointSet,std::vector<double>> cache;
+
+        // Equal contents at different addresses share the entry
+        auto p_points = std::make_unique<PointSet>( PointSet {{0.0, 1.0}, {2.0, 3.0}} );
+        cache.insert( *p_points, generator );
+
+        const PointSet copy = *p_points;
+        p_points.reset();
+
+        CIE_TEST_CHECK( cache.cached(copy) );
+        CIE_TEST_CHECK( !cache.cached(PointSet {{0.0, 1.0}}) );
+        cache.insert( copy, generator );
+        CIE_TEST_CHECK( cache.size() == 1 );
+        CIE_TEST_CHECK( cache.statistics().hits == 1 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "quantized" )
+
+        ContainerCache<PointSet,std::vector<double>,LRUEviction,QuantizedContainerHash> cache( QuantizedContainerHash(1e-8), 2 );
+        CIE_TEST_CHECK( cache.maxEntries() == 2 );
+        CIE_TEST_CHECK( cache.hasher().resolution() == Approx(1e-8) );
+
+        cache.insert( PointSet {{1.0/3.0, 0.5}}, generator );
+        CIE_TEST_CHECK( cache.cached(PointSet {{1.0 - 2.0/3.0, 0.5}}) );
+    }
+}
+
+
+template <class EvictionPolicy>
+class TestBoundedCache : public AbsCache<int,std::vector<int>,EvictionPolicy>
+{
+public:
+    using AbsCache<int,std::vector<int>,EvictionPolicy>::AbsCache;
+
+    virtual Size hash( const int& input ) const override
+    { return Size(input); }
+};
+
+
+CIE_TEST_CASE( "AbsCache - LRU eviction", "[cache]" )
+{
+    CIE_TEST_CASE_INIT( "AbsCache - LRU eviction" )
+
+    using TestCache = TestBoundedCache<LRUEviction>;
+    auto generator = []( const int& input ) { return std::vector<int>( 1, input ); };
+
+    CIE_TEST_CHECK_THROWS( TestCache(0) );
+
+    TestCache cache( 3 );
+    CIE_TEST_CHECK( cache.maxEntries() == 3 );
+
+    for ( int i=0; i<3; ++i )
+        CIE_TEST_CHECK_NOTHROW( cache.insert(i, generator) );
+    CIE_TEST_CHECK( cache.size() == 3 );
+
+    // Use 0 -> 1 is the least recently used
+    CIE_TEST_CHECK( cache[0][0] == 0 );
+    CIE_TEST_CHECK_NOTHROW( cache.insert(3, generator) );
+
+    CIE_TEST_CHECK( cache.size() == 3 );
+    CIE_TEST_CHECK( cache.cached(0) );
+    CIE_TEST_CHECK( !cache.cached(1) );
+    CIE_TEST_CHECK( cache.cached(2) );
+    CIE_TEST_CHECK( cache.cached(3) );
+
+    // Hitting 2 through insert counts as a use too -> 0 is evicted next
+    CIE_TEST_CHECK_NOTHROW( cache.insert(2, generator) );
+    CIE_TEST_CHECK_NOTHROW( cache.insert(4, generator) );
+    CIE_TEST_CHECK( !cache.cached(0) );
+    CIE_TEST_CHECK( cache.cached(2) );
+
+    const auto& r_statistics = cache.statistics();
+    CIE_TEST_CHECK( r_statistics.hits == 2 );
+    CIE_TEST_CHECK( r_statistics.misses == 5 );
+    CIE_TEST_CHECK( r_statistics.evictions == 2 );
+    CIE_TEST_CHECK( r_statistics.hitRate() == Approx(2.0 / 7.0) );
 
-}
\ No newline at end of file
+    CIE_TEST_CHECK_THROWS( cache[1] );
+    CIE_TEST_CHECK( cache.statistics().misses == 6 );
+
+    cache.resetStatistics();
+    CIE_TEST_CHECK( cache.statistics().hits == 0 );
+    CIE_TEST_CHECK( cache.statistics().hitRate() == 0.0 );
+
+    cache.erase( 2 );
+    CIE_TEST_CHECK( cache.size() == 2 );
+    cache.clear();
+    CIE_TEST_CHECK( cache.size() == 0 );
+    CIE_TEST_CHECK( cache.bytes() == 0 );
+}
+
+
+CIE_TEST_CASE( "AbsCache - LFU eviction", "[cache]" )
+{
+    CIE_TEST_CASE_INIT( "AbsCache - LFU eviction" )
+
+    using TestCache = TestBoundedCache<LFUEviction>;
+    auto generator = []( const int& input ) { return std::vector<int>( 1, input ); };
+
+    TestCache cache( 3 );
+
+    for ( int i=0; i<3; ++i )
+        CIE_TEST_CHECK_NOTHROW( cache.insert(i, generator) );
+
+    // 0 and 2 are used more often than 1
+    for ( int i=0; i<3; ++i )
+    {
+        CIE_TEST_CHECK( cache[0][0] == 0 );
+        CIE_TEST_CHECK( cache[2][0] == 2 );
+    }
+
+    CIE_TEST_CHECK_NOTHROW( cache.insert(3, generator) );
+    CIE_TEST_CHECK( !cache.cached(1) );
+
+    // 3 has the fewest uses
+    CIE_TEST_CHECK_NOTHROW( cache.insert(4, generator) );
+    CIE_TEST_CHECK( !cache.cached(3) );
+    CIE_TEST_CHECK( cache.cached(0) );
+    CIE_TEST_CHECK( cache.cached(2) );
+    CIE_TEST_CHECK( cache.cached(4) );
+    CIE_TEST_CHECK( cache.statistics().evictions == 2 );
+}
+
+
+CIE_TEST_CASE( "AbsCache - byte budget", "[cache]" )
+{
+    CIE_TEST_CASE_INIT( "AbsCache - byte budget" )
+
+    using TestCache = TestBoundedCache<LRUEviction>;
+    auto generator = []( const int& input ) { return std::vector<int>( input, input ); };
+    auto sizeFunction = []( const std::vector<int>& r_value ) { return r_value.size(); };
+
+    TestCache cache( 100, 10, sizeFunction );
+
+    CIE_TEST_CHECK_NOTHROW( cache.insert(4, generator) );
+    CIE_TEST_CHECK_NOTHROW( cache.insert(5, generator) );
+    CIE_TEST_CHECK( cache.bytes() == 9 );
+
+    // Doesn't fit -> evict 4
+    CIE_TEST_CHECK_NOTHROW( cache.insert(3, generator) );
+    CIE_TEST_CHECK( !cache.cached(4) );
+    CIE_TEST_CHECK( cache.bytes() == 8 );
+
+    // Forced reinsertion updates the size
+    CIE_TEST_CHECK_NOTHROW( cache.insert(3, std::vector<int>(1,3), true) );
+    CIE_TEST_CHECK( cache.bytes() == 6 );
+    CIE_TEST_CHECK( cache[3].size() == 1 );
+
+    // Entries larger than the budget replace all others
+    CIE_TEST_CHECK_NOTHROW( cache.insert(11, generator) );
+    CIE_TEST_CHECK( cache.size() == 1 );
+    CIE_TEST_CHECK( cache.bytes() == 11 );
+
+    cache.erase( 11 );
+    CIE_TEST_CHECK( cache.bytes() == 0 );
+}
+
+
+}
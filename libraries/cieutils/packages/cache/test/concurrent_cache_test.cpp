@@ -0,0 +1,117 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/cache/inc/concurrent_cache.hpp"
+#include "cieutils/packages/concurrency/inc/ParallelFor.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+
+namespace cie::utils {
+
+
+class TestConcurrentCache : public ConcurrentCache<int,std::vector<int>>
+{
+public:
+    using ConcurrentCache<int,std::vector<int>>::ConcurrentCache;
+
+    virtual Size hash( const int& input ) const override
+    { return Size(input); }
+};
+
+
+CIE_TEST_CASE( "ConcurrentCache", "[cache]" )
+{
+    CIE_TEST_CASE_INIT( "ConcurrentCache" )
+
+    auto generator = []( const int& input ) { return std::vector<int>( 2, input ); };
+
+    {
+        CIE_TEST_CASE_INIT( "serial" )
+
+        TestConcurrentCache cache( 4 );
+
+        CIE_TEST_CHECK_THROWS( cache[0] );
+        CIE_TEST_CHECK( !cache.cached(0) );
+
+        auto p_value = cache.insert( 1, generator );
+        CIE_TEST_REQUIRE( p_value );
+        CIE_TEST_CHECK( p_value->size() == 2 );
+        CIE_TEST_CHECK( p_value->front() == 1 );
+        CIE_TEST_CHECK( cache.cached(1) );
+        CIE_TEST_CHECK( cache.size() == 1 );
+
+        // Existing values are not regenerated unless forced
+        CIE_TEST_CHECK( cache.insert(1, std::vector<int>(1,5)) == p_value );
+        CIE_TEST_CHECK( cache.insert(1, std::vector<int>(1,5), true)->front() == 5 );
+        CIE_TEST_CHECK( cache[1]->front() == 5 );
+
+        // Previously returned values outlive their entries
+        cache.erase( 1 );
+        CIE_TEST_CHECK( !cache.cached(1) );
+        CIE_TEST_CHECK( p_value->front() == 1 );
+
+        // Failed generators don't leave entries behind
+        auto failing = []( const int& ) -> std::vector<int> { throw std::runtime_error("failed generator"); };
+        CIE_TEST_CHECK_THROWS( cache.insert(2, failing) );
+        CIE_TEST_CHECK( !cache.cached(2) );
+        CIE_TEST_CHECK( cache.insert(2, generator)->front() == 2 );
+
+        const auto statistics = cache.statistics();
+        CIE_TEST_CHECK( statistics.hits == 2 );
+        CIE_TEST_CHECK( statistics.misses == 5 );
+
+        cache.resetStatistics();
+        CIE_TEST_CHECK( cache.statistics().hits == 0 );
+
+        // A failed generator doesn't erase an entry that replaced its own
+        auto replacing = [&cache]( const int& input ) -> std::vector<int>
+        {
+            cache.insert( input, std::vector<int>(1,7), true );
+            throw std::runtime_error( "failed generator" );
+        };
+        CIE_TEST_CHECK_THROWS( cache.insert(3, replacing) );
+        CIE_TEST_REQUIRE( cache.cached(3) );
+        CIE_TEST_CHECK( cache[3]->front() == 7 );
+
+        cache.clear();
+        CIE_TEST_CHECK( cache.size() == 0 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "parallel" )
+
+        const int numberOfKeys = 100;
+        TestConcurrentCache cache;
+        std::atomic<Size> numberOfGenerations = 0;
+        std::atomic<Size> numberOfErrors = 0;
+
+        auto countingGenerator = [&numberOfGenerations]( const int& input )
+        {
+            ++numberOfGenerations;
+            return std::vector<int>( 2, input );
+        };
+
+        mp::ParallelFor<int>().setSchedule( mp::LoopSchedule::Dynamic, 4 )(
+            20 * numberOfKeys,
+            [&]( int index ) -> void
+            {
+                const int key = index % numberOfKeys;
+                if ( cache.insert(key, countingGenerator)->back() != key )
+                    ++numberOfErrors;
+            }
+        );
+
+        // Every value is generated exactly once
+        CIE_TEST_CHECK( numberOfErrors == 0 );
+        CIE_TEST_CHECK( numberOfGenerations == Size(numberOfKeys) );
+        CIE_TEST_CHECK( cache.size() == Size(numberOfKeys) );
+        CIE_TEST_CHECK( cache.statistics().misses == Size(numberOfKeys) );
+        CIE_TEST_CHECK( cache.statistics().hits == Size(19 * numberOfKeys) );
+    }
+}
+
+
+} // namespace cie::utils
@@ -0,0 +1,255 @@
+#ifndef CIE_UTILS_CONCURRENCY_CONCURRENT_HASH_MAP_IMPL_HPP
+#define CIE_UTILS_CONCURRENCY_CONCURRENT_HASH_MAP_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <mutex>
+#include <utility>
+#include <algorithm>
+
+
+namespace cie::mp {
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::ConcurrentHashMap( Size numberOfShards,
+                                                                           const HashType& r_hash ) :
+    _shards(),
+    _mask( 0 ),
+    _hash( r_hash )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Size size = 1;
+    while ( size < numberOfShards )
+        size <<= 1;
+
+    this->_mask = size - 1;
+
+    this->_shards.reserve( size );
+    for ( Size i=0; i<size; ++i )
+        this->_shards.emplace_back( new Shard );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+template <class ...Args>
+inline bool
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::emplace( const KeyType& r_key,
+                                                                 Args&&... r_args )
+{
+    auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+    std::unique_lock<mutex_type> lock( r_shard.mutex );
+    return r_shard.map.try_emplace( r_key, std::forward<Args>(r_args)... ).second;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline bool
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::insert( const typename ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::value_type& r_value )
+{
+    return this->emplace( r_value.first, r_value.second );
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+template <class InputIt>
+inline Size
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::insert( InputIt it_begin,
+                                                                InputIt it_end )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Sort the items by shard, then lock each affected shard once
+    std::vector<std::pair<Size,InputIt>> items;
+    for ( ; it_begin!=it_end; ++it_begin )
+        items.emplace_back( this->shardIndex(it_begin->first), it_begin );
+
+    std::stable_sort(
+        items.begin(),
+        items.end(),
+        []( const auto& r_lhs, const auto& r_rhs ) { return r_lhs.first < r_rhs.first; }
+    );
+
+    Size numberOfInsertions = 0;
+
+    for ( auto it_item=items.begin(); it_item!=items.end(); )
+    {
+        auto& r_shard = *this->_shards[it_item->first];
+        std::unique_lock<mutex_type> lock( r_shard.mutex );
+
+        const Size shardIndex = it_item->first;
+        for ( ; it_item!=items.end() && it_item->first==shardIndex; ++it_item )
+            if ( r_shard.map.try_emplace(it_item->second->first, it_item->second->second).second )
+                ++numberOfInsertions;
+    }
+
+    return numberOfInsertions;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+template <class ValueArgument>
+inline void
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::insertOrAssign( const KeyType& r_key,
+                                                                        ValueArgument&& r_value )
+{
+    auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+    std::unique_lock<mutex_type> lock( r_shard.mutex );
+    r_shard.map.insert_or_assign( r_key, std::forward<ValueArgument>(r_value) );
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+template <class GeneratorType>
+inline ValueType
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::getOrInsert( const KeyType& r_key,
+                                                                     GeneratorType&& r_generator )
+{
+    auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+
+    {
+        std::shared_lock<mutex_type> lock( r_shard.mutex );
+        auto it = r_shard.map.find( r_key );
+        if ( it != r_shard.map.end() )
+            return it->second;
+    }
+
+    // Don't block the shard while generating the value
+    ValueType value = r_generator();
+
+    std::unique_lock<mutex_type> lock( r_shard.mutex );
+    return r_shard.map.try_emplace( r_key, std::move(value) ).first->second;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline std::optional<ValueType>
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::find( const KeyType& r_key ) const
+{
+    const auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+    std::shared_lock<mutex_type> lock( r_shard.mutex );
+
+    auto it = r_shard.map.find( r_key );
+    if ( it == r_shard.map.end() )
+        return std::nullopt;
+
+    return it->second;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline bool
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::contains( const KeyType& r_key ) const
+{
+    const auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+    std::shared_lock<mutex_type> lock( r_shard.mutex );
+    return r_shard.map.find( r_key ) != r_shard.map.end();
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline bool
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::erase( const KeyType& r_key )
+{
+    auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+    std::unique_lock<mutex_type> lock( r_shard.mutex );
+    return r_shard.map.erase( r_key ) != 0;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+template <class PredicateType>
+inline bool
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::eraseIf( const KeyType& r_key, PredicateType&& r_predicate )
+{
+    auto& r_shard = *this->_shards[this->shardIndex(r_key)];
+    std::unique_lock<mutex_type> lock( r_shard.mutex );
+
+    auto it = r_shard.map.find( r_key );
+    if ( it == r_shard.map.end() || !r_predicate(std::as_const(it->second)) )
+        return false;
+
+    r_shard.map.erase( it );
+    return true;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline void
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::clear()
+{
+    for ( auto& rp_shard : this->_shards )
+    {
+        std::unique_lock<mutex_type> lock( rp_shard->mutex );
+        rp_shard->map.clear();
+    }
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline Size
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::size() const
+{
+    Size size = 0;
+
+    for ( const auto& rp_shard : this->_shards )
+    {
+        std::shared_lock<mutex_type> lock( rp_shard->mutex );
+        size += rp_shard->map.size();
+    }
+
+    return size;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline bool
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::empty() const
+{
+    return this->size() == 0;
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline Size
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::numberOfShards() const
+{
+    return this->_shards.size();
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+template <class FunctionType>
+inline void
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::forEach( FunctionType&& r_function ) const
+{
+    for ( const auto& rp_shard : this->_shards )
+    {
+        std::shared_lock<mutex_type> lock( rp_shard->mutex );
+        for ( const auto& r_pair : rp_shard->map )
+            r_function( r_pair.first, r_pair.second );
+    }
+}
+
+
+template <class KeyType, class ValueType, class HashType, class KeyEqual>
+inline Size
+ConcurrentHashMap<KeyType,ValueType,HashType,KeyEqual>::shardIndex( const KeyType& r_key ) const
+{
+    // Scramble the hash, so the shard index does not correlate with
+    // the bucket index inside the shard's map
+    return ( (Size(this->_hash(r_key)) * 0x9e3779b97f4a7c15) >> 32 ) & this->_mask;
+}
+
+
+} // namespace cie::mp
+
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef CIE_UTILS_CONCURRENCY_JOB_HANDLE_IMPL_HPP
+#define CIE_UTILS_CONCURRENCY_JOB_HANDLE_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+
+
+namespace cie::mp {
+
+
+template <class ResultType>
+JobHandle<ResultType>::JobHandle( typename JobHandle<ResultType>::state_ptr p_state,
+                                  ThreadPool& r_pool ) :
+    _p_state( p_state ),
+    _p_pool( &r_pool )
+{
+}
+
+
+template <class ResultType>
+inline bool
+JobHandle<ResultType>::done() const
+{
+    return this->_p_state->done.load( std::memory_order_acquire );
+}
+
+
+template <class ResultType>
+inline void
+JobHandle<ResultType>::wait() const
+{
+    this->_p_pool->waitFor( *this );
+}
+
+
+template <class ResultType>
+inline typename JobHandle<ResultType>::const_reference
+JobHandle<ResultType>::get() const
+{
+    this->wait();
+
+    if ( this->_p_state->exception )
+        std::rethrow_exception( this->_p_state->exception );
+
+    if constexpr ( !std::is_void_v<ResultType> )
+        return *this->_p_state->result;
+}
+
+
+} // namespace cie::mp
+
+
+#endif
@@ -5,6 +5,10 @@
 #include "cieutils/packages/macros/inc/exceptions.hpp"
 #include "cieutils/packages/macros/inc/checks.hpp"
 
+// --- STL Includes ---
+#include <algorithm>
+#include <functional>
+
 
 namespace cie::mp {
 
@@ -14,7 +18,9 @@ template < concepts::Integer IndexType,
 template <class ...Args>
 ParallelFor<IndexType,StorageType>::ParallelFor( Args&&... r_args ) :
     _storage( std::forward<Args>(r_args)... ),
-    _p_pool( nullptr )
+    _p_pool( nullptr ),
+    _schedule( LoopSchedule::Static ),
+    _chunkSize( 0 )
 {
 }
 
@@ -43,6 +49,51 @@ ParallelFor<IndexType,StorageType>::setPool( ThreadPoolPtr p_pool )
 }
 
 
+template < concepts::Integer IndexType,
+           class StorageType >
+ParallelFor<IndexType,StorageType>&
+ParallelFor<IndexType,StorageType>::setSchedule( LoopSchedule schedule,
+                                                 IndexType chunkSize )
+{
+    this->_schedule = schedule;
+    return this->setChunkSize( chunkSize );
+}
+
+
+template < concepts::Integer IndexType,
+           class StorageType >
+ParallelFor<IndexType,StorageType>&
+ParallelFor<IndexType,StorageType>::setChunkSize( IndexType chunkSize )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_OUT_OF_RANGE_CHECK( 0 <= chunkSize )
+
+    this->_chunkSize = chunkSize;
+    return *this;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template < concepts::Integer IndexType,
+           class StorageType >
+inline LoopSchedule
+ParallelFor<IndexType,StorageType>::schedule() const
+{
+    return this->_schedule;
+}
+
+
+template < concepts::Integer IndexType,
+           class StorageType >
+inline IndexType
+ParallelFor<IndexType,StorageType>::chunkSize() const
+{
+    return this->_chunkSize;
+}
+
+
 template < concepts::Integer IndexType,
            class StorageType >
 inline void
@@ -54,9 +105,10 @@ ParallelFor<IndexType,StorageType>::operator()( IndexType indexMin,
     CIE_BEGIN_EXCEPTION_TRACING
 
     this->execute(
-        std::move( this->makeIndexPartition(indexMin,indexMax,stepSize) ),
+        indexMin,
+        indexMax,
         stepSize,
-        std::forward<typename StorageType::loop_function>(r_function)
+        [&r_function]( IndexType, IndexType index, auto&... r_args ) -> void { r_function( index, r_args... ); }
     );
 
     CIE_END_EXCEPTION_TRACING
@@ -71,8 +123,9 @@ ParallelFor<IndexType,StorageType>::operator()( IndexType indexMax,
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    this->execute(
-        std::move( this->makeIndexPartition(0, indexMax, 1) ),
+    this->operator()(
+        0,
+        indexMax,
         1,
         std::forward<typename StorageType::loop_function>(r_function)
     );
@@ -91,10 +144,10 @@ ParallelFor<IndexType,StorageType>::operator()( ContainerType& r_container,
     CIE_BEGIN_EXCEPTION_TRACING
 
     this->execute(
-        std::move( this->makeIndexPartition(0,r_container.size(),1) ),
+        0,
+        r_container.size(),
         1,
-        r_container,
-        std::forward<typename StorageType::object_loop_function<typename ContainerType::value_type>>( r_function )
+        [&r_function, &r_container]( IndexType, IndexType index, auto&... r_args ) -> void { r_function( r_container[index], r_args... ); }
     );
 
     CIE_END_EXCEPTION_TRACING
@@ -103,47 +156,64 @@ ParallelFor<IndexType,StorageType>::operator()( ContainerType& r_container,
 
 template < concepts::Integer IndexType,
            class StorageType >
-typename ParallelFor<IndexType,StorageType>::index_partition
-ParallelFor<IndexType,StorageType>::makeIndexPartition( IndexType indexMin,
-                                                        IndexType indexMax,
-                                                        IndexType stepSize )
+template <class ValueType, class CombineFunction, class LoopFunction>
+inline ValueType
+ParallelFor<IndexType,StorageType>::reduce( IndexType indexMin,
+                                            IndexType indexMax,
+                                            IndexType stepSize,
+                                            const ValueType& r_identity,
+                                            CombineFunction&& r_combine,
+                                            LoopFunction&& r_function )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    // Create a pool if one wasn't provided already
+    // Fall back to the default pool if none was provided
     if ( !this->_p_pool )
-        this->_p_pool.reset( new ThreadPool );
+        this->_p_pool = ThreadPoolSingleton::getPtr();
 
-    // Check index range
-    CIE_OUT_OF_RANGE_CHECK( stepSize != 0 )
-    CIE_OUT_OF_RANGE_CHECK( (indexMin <= indexMax) == (0 < stepSize) );
+    // One accumulator per job, each on its own cache line
+    std::vector<detail::CacheLinePadded<ValueType>> accumulators(
+        this->_p_pool->size(),
+        detail::CacheLinePadded<ValueType> {r_identity}
+    );
 
-    // Handle reverse loops
-    if ( stepSize < 0 )
-    {
-        auto tmp = indexMin;
-        indexMin = indexMax;
-        indexMax = tmp;
-        stepSize = 0 - stepSize;
-    }
+    this->execute(
+        indexMin,
+        indexMax,
+        stepSize,
+        [&r_function, &accumulators]( IndexType jobIndex, IndexType index, auto&... r_args ) -> void
+        { r_function( index, accumulators[jobIndex].value, r_args... ); }
+    );
 
-    typename ParallelFor<IndexType,StorageType>::index_partition indexPartition;
+    ValueType result = r_identity;
+    for ( const auto& r_accumulator : accumulators )
+        result = r_combine( result, r_accumulator.value );
 
-    // Initialize index blocks
-    IndexType blockSize = stepSize * (indexMax - indexMin) / (stepSize * this->_p_pool->size() + 1);
+    return result;
 
-    if ( blockSize == 0 )
-        blockSize = 1;
+    CIE_END_EXCEPTION_TRACING
+}
 
-    IndexType tmp = indexMin;
-    
-    indexPartition.reserve( this->_p_pool->size() + 1 );
-    for ( IndexType i=0; i<this->_p_pool->size() && tmp<indexMax; ++i, tmp+=blockSize )
-        indexPartition.push_back( tmp );
-    
-    indexPartition.push_back( indexMax );
 
-    return indexPartition;
+template < concepts::Integer IndexType,
+           class StorageType >
+template <class ValueType, class CombineFunction, class LoopFunction>
+inline ValueType
+ParallelFor<IndexType,StorageType>::reduce( IndexType indexMax,
+                                            const ValueType& r_identity,
+                                            CombineFunction&& r_combine,
+                                            LoopFunction&& r_function )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return this->reduce(
+        0,
+        indexMax,
+        1,
+        r_identity,
+        std::forward<CombineFunction>(r_combine),
+        std::forward<LoopFunction>(r_function)
+    );
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -151,36 +221,31 @@ ParallelFor<IndexType,StorageType>::makeIndexPartition( IndexType indexMin,
 
 template < concepts::Integer IndexType,
            class StorageType >
-void
-ParallelFor<IndexType,StorageType>::execute( const typename ParallelFor<IndexType,StorageType>::index_partition& r_indexPartition,
-                                             IndexType stepSize,
-                                             const typename StorageType::loop_function& r_function )
+typename ParallelFor<IndexType,StorageType>::index_partition
+ParallelFor<IndexType,StorageType>::makeIndexPartition( IndexType numberOfIterations,
+                                                        IndexType numberOfBlocks )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    CIE_OUT_OF_RANGE_CHECK( r_indexPartition.size() <= this->_p_pool->size() + 1 )
+    CIE_OUT_OF_RANGE_CHECK( 0 < numberOfBlocks )
+
+    typename ParallelFor<IndexType,StorageType>::index_partition indexPartition;
+    indexPartition.reserve( numberOfBlocks + 1 );
+
+    // Distribute the remainder among the first blocks
+    const IndexType blockSize = numberOfIterations / numberOfBlocks;
+    const IndexType remainder = numberOfIterations % numberOfBlocks;
 
-    // Schedule jobs
-    for ( IndexType parititonIndex=0; parititonIndex<r_indexPartition.size()-1; ++parititonIndex )
+    IndexType blockBegin = 0;
+    for ( IndexType i=0; i<numberOfBlocks; ++i )
     {
-        this->_p_pool->queueJob(
-            [this, parititonIndex, stepSize, r_indexPartition, r_function]() -> void
-            {
-                typename StorageType::storage_type storage = this->_storage.values();
-                typename StorageType::reference_storage storageReference = std::make_from_tuple<typename StorageType::reference_storage>( storage );
-
-                for ( IndexType i=r_indexPartition[parititonIndex]; i<r_indexPartition[parititonIndex+1]; i+=stepSize )
-                {
-                    std::apply(
-                        [i,&r_function]( auto&... args ) -> void { r_function(i,args...); },
-                        storageReference
-                    );
-                }
-            }
-        );
+        indexPartition.push_back( blockBegin );
+        blockBegin += blockSize + (i < remainder ? 1 : 0);
     }
 
-    this->_p_pool->barrier();
+    indexPartition.push_back( numberOfIterations );
+
+    return indexPartition;
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -188,44 +253,128 @@ ParallelFor<IndexType,StorageType>::execute( const typename ParallelFor<IndexTyp
 
 template < concepts::Integer IndexType,
            class StorageType >
-template <concepts::STLContainer ContainerType>
+template <class LoopBody>
 void
-ParallelFor<IndexType,StorageType>::execute( const typename ParallelFor<IndexType,StorageType>::index_partition& r_indexPartition,
+ParallelFor<IndexType,StorageType>::execute( IndexType indexMin,
+                                             IndexType indexMax,
                                              IndexType stepSize,
-                                             ContainerType& r_container,
-                                             typename StorageType::object_loop_function<typename ContainerType::value_type>&& r_function )
+                                             const LoopBody& r_body )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    CIE_OUT_OF_RANGE_CHECK( r_indexPartition.size() <= this->_p_pool->size() + 1 )
+    // Fall back to the default pool if none was provided
+    if ( !this->_p_pool )
+        this->_p_pool = ThreadPoolSingleton::getPtr();
+
+    // Check index range
+    CIE_OUT_OF_RANGE_CHECK( stepSize != 0 )
+    CIE_OUT_OF_RANGE_CHECK( (indexMin <= indexMax) == (0 < stepSize) )
+
+    // Loop over iterations [0,numberOfIterations) and map them to indices (handles reverse loops)
+    IndexType numberOfIterations = 0;
+    if ( 0 < stepSize )
+        numberOfIterations = (indexMax - indexMin + stepSize - 1) / stepSize;
+    else
+        numberOfIterations = (indexMin - indexMax - stepSize - 1) / (0 - stepSize);
+
+    if ( numberOfIterations == 0 )
+        return;
 
-    // Schedule jobs
-    for ( IndexType parititonIndex=0; parititonIndex<r_indexPartition.size()-1; ++parititonIndex )
+    const IndexType numberOfJobs = std::min( IndexType(this->_p_pool->size()), numberOfIterations );
+    const LoopSchedule schedule  = this->_schedule;
+    const IndexType chunkSize    = this->_chunkSize ? this->_chunkSize : 1;
+
+    index_partition indexPartition;
+    if ( schedule == LoopSchedule::Static && this->_chunkSize == 0 )
+        indexPartition = this->makeIndexPartition( numberOfIterations, numberOfJobs );
+
+    // Shared iteration counter for dynamic schedules
+    std::atomic<IndexType> counter = 0;
+
+    auto job = [&, this]( IndexType jobIndex ) -> void
     {
-        this->_p_pool->queueJob(
-            [this, parititonIndex, stepSize, r_indexPartition, r_function, &r_container]() -> void
+        // Thread-private copy of the storage
+        typename StorageType::storage_type storage = this->_storage.values();
+        typename StorageType::reference_storage storageReference = std::make_from_tuple<typename StorageType::reference_storage>( storage );
+
+        auto loopChunk = [&]( IndexType begin, IndexType end ) -> void
+        {
+            for ( IndexType i=begin; i<end; ++i )
             {
-                typename StorageType::storage_type storage = this->_storage.values();
-                typename StorageType::reference_storage storageReference = std::make_from_tuple<typename StorageType::reference_storage>( storage );
-
-                for ( IndexType i=r_indexPartition[parititonIndex]; i<r_indexPartition[parititonIndex+1]; i+=stepSize )
-                {
-                    std::apply(
-                        [i,&r_function,&r_container]( auto&... args ) -> void { r_function(r_container[i],args...); },
-                        storageReference
-                    );
-                }
+                std::apply(
+                    [i,jobIndex,indexMin,stepSize,&r_body]( auto&... r_args ) -> void { r_body( jobIndex, indexMin + i*stepSize, r_args... ); },
+                    storageReference
+                );
             }
-        );
-    }
+        };
+
+        IndexType begin, end;
+
+        switch ( schedule )
+        {
+            case LoopSchedule::Static:
+                if ( indexPartition.empty() )
+                    for ( begin=jobIndex*chunkSize; begin<numberOfIterations; begin+=numberOfJobs*chunkSize )
+                        loopChunk( begin, std::min(begin + chunkSize, numberOfIterations) );
+                else
+                    loopChunk( indexPartition[jobIndex], indexPartition[jobIndex+1] );
+                break;
+
+            case LoopSchedule::Dynamic:
+                while ( (begin = counter.fetch_add(chunkSize)) < numberOfIterations )
+                    loopChunk( begin, std::min(begin + chunkSize, numberOfIterations) );
+                break;
+
+            case LoopSchedule::Guided:
+                while ( nextGuidedChunk(counter, numberOfIterations, numberOfJobs, chunkSize, begin, end) )
+                    loopChunk( begin, end );
+                break;
+        }
+    };
+
+    // Schedule jobs and wait for them (not for unrelated jobs in the pool)
+    std::vector<JobHandle<void>> handles;
+    handles.reserve( numberOfJobs );
+
+    for ( IndexType jobIndex=0; jobIndex<numberOfJobs; ++jobIndex )
+        handles.push_back( this->_p_pool->submit( std::cref(job), jobIndex ) ); // reference keeps the job small
+
+    this->_p_pool->waitFor( handles );
 
-    this->_p_pool->barrier();
+    // Rethrow exceptions from the loop body
+    for ( const auto& r_handle : handles )
+        r_handle.get();
 
     CIE_END_EXCEPTION_TRACING
 }
 
 
+template < concepts::Integer IndexType,
+           class StorageType >
+inline bool
+ParallelFor<IndexType,StorageType>::nextGuidedChunk( std::atomic<IndexType>& r_counter,
+                                                     IndexType numberOfIterations,
+                                                     IndexType numberOfThreads,
+                                                     IndexType minChunkSize,
+                                                     IndexType& r_begin,
+                                                     IndexType& r_end )
+{
+    r_begin = r_counter.load();
+
+    while ( r_begin < numberOfIterations )
+    {
+        IndexType chunkSize = std::max( (numberOfIterations - r_begin) / (2 * numberOfThreads), minChunkSize );
+        r_end = std::min( r_begin + chunkSize, numberOfIterations );
+
+        if ( r_counter.compare_exchange_weak(r_begin, r_end) )
+            return true;
+    }
+
+    return false;
+}
+
+
 } // namespace cie::mp
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,93 @@
+#ifndef CIE_UTILS_CONCURRENCY_PRIORITY_JOB_QUEUE_IMPL_HPP
+#define CIE_UTILS_CONCURRENCY_PRIORITY_JOB_QUEUE_IMPL_HPP
+
+// --- STL Includes ---
+#include <algorithm>
+#include <utility>
+
+
+namespace cie::mp {
+
+
+template <class JobType>
+PriorityJobQueue<JobType>::PriorityJobQueue() :
+    _heap(),
+    _counter( 0 )
+{
+}
+
+
+template <class JobType>
+inline void
+PriorityJobQueue<JobType>::push( typename PriorityJobQueue<JobType>::job_type&& r_job,
+                                 typename PriorityJobQueue<JobType>::priority_type priority )
+{
+    this->_heap.push_back( Entry {priority, this->_counter++, std::move(r_job)} );
+    std::push_heap( this->_heap.begin(), this->_heap.end(), &PriorityJobQueue<JobType>::compare );
+}
+
+
+template <class JobType>
+inline bool
+PriorityJobQueue<JobType>::pop( typename PriorityJobQueue<JobType>::job_type& r_job )
+{
+    if ( this->_heap.empty() )
+        return false;
+
+    std::pop_heap( this->_heap.begin(), this->_heap.end(), &PriorityJobQueue<JobType>::compare );
+    r_job = std::move( this->_heap.back().job );
+    this->_heap.pop_back();
+
+    return true;
+}
+
+
+template <class JobType>
+inline typename PriorityJobQueue<JobType>::priority_type
+PriorityJobQueue<JobType>::topPriority() const
+{
+    return this->_heap.empty() ? 0 : this->_heap.front().priority;
+}
+
+
+template <class JobType>
+inline Size
+PriorityJobQueue<JobType>::size() const
+{
+    return this->_heap.size();
+}
+
+
+template <class JobType>
+inline bool
+PriorityJobQueue<JobType>::empty() const
+{
+    return this->_heap.empty();
+}
+
+
+template <class JobType>
+inline void
+PriorityJobQueue<JobType>::clear()
+{
+    this->_heap.clear();
+}
+
+
+template <class JobType>
+inline bool
+PriorityJobQueue<JobType>::compare( const typename PriorityJobQueue<JobType>::Entry& r_lhs,
+                                    const typename PriorityJobQueue<JobType>::Entry& r_rhs )
+{
+    // std heaps keep the "largest" element on top
+    if ( r_lhs.priority != r_rhs.priority )
+        return r_lhs.priority < r_rhs.priority;
+
+    return r_rhs.index < r_lhs.index;
+}
+
+
+} // namespace cie::mp
+
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef CIE_UTILS_CONCURRENCY_TASK_IMPL_HPP
+#define CIE_UTILS_CONCURRENCY_TASK_IMPL_HPP
+
+// --- STL Includes ---
+#include <new>
+#include <utility>
+
+
+namespace cie::mp {
+
+
+template <class FunctionType>
+const Task::Operations Task::inlineOperations = {
+    []( void* p_buffer ) -> void
+    { (*static_cast<FunctionType*>(p_buffer))(); },
+    []( void* p_source, void* p_target ) -> void
+    {
+        FunctionType* p_function = static_cast<FunctionType*>( p_source );
+        new (p_target) FunctionType( std::move(*p_function) );
+        p_function->~FunctionType();
+    },
+    []( void* p_buffer ) -> void
+    { static_cast<FunctionType*>(p_buffer)->~FunctionType(); },
+    true
+};
+
+
+template <class FunctionType>
+const Task::Operations Task::heapOperations = {
+    []( void* p_buffer ) -> void
+    { (**static_cast<FunctionType**>(p_buffer))(); },
+    []( void* p_source, void* p_target ) -> void
+    { *static_cast<FunctionType**>(p_target) = *static_cast<FunctionType**>(p_source); },
+    []( void* p_buffer ) -> void
+    { delete *static_cast<FunctionType**>(p_buffer); },
+    false
+};
+
+
+inline Task::Task() :
+    _p_operations( nullptr )
+{
+}
+
+
+inline Task::Task( std::nullptr_t ) :
+    Task()
+{
+}
+
+
+template <class FunctionType>
+requires (!std::is_same_v<std::decay_t<FunctionType>,Task>)
+         && std::is_invocable_v<std::decay_t<FunctionType>&>
+inline Task::Task( FunctionType&& r_function )
+{
+    using function_type = std::decay_t<FunctionType>;
+
+    if constexpr ( Task::storedInline<function_type> )
+    {
+        new (this->_buffer) function_type( std::forward<FunctionType>(r_function) );
+        this->_p_operations = &Task::inlineOperations<function_type>;
+    }
+    else
+    {
+        *reinterpret_cast<function_type**>(this->_buffer) = new function_type( std::forward<FunctionType>(r_function) );
+        this->_p_operations = &Task::heapOperations<function_type>;
+    }
+}
+
+
+inline Task::Task( Task&& r_rhs ) noexcept :
+    _p_operations( r_rhs._p_operations )
+{
+    if ( this->_p_operations )
+    {
+        this->_p_operations->move( r_rhs._buffer, this->_buffer );
+        r_rhs._p_operations = nullptr;
+    }
+}
+
+
+inline Task& Task::operator=( Task&& r_rhs ) noexcept
+{
+    if ( this != &r_rhs )
+    {
+        this->reset();
+
+        if ( r_rhs._p_operations )
+        {
+            r_rhs._p_operations->move( r_rhs._buffer, this->_buffer );
+            this->_p_operations = r_rhs._p_operations;
+            r_rhs._p_operations = nullptr;
+        }
+    }
+
+    return *this;
+}
+
+
+inline Task& Task::operator=( std::nullptr_t )
+{
+    this->reset();
+    return *this;
+}
+
+
+inline Task::~Task()
+{
+    this->reset();
+}
+
+
+inline void Task::operator()()
+{
+    this->_p_operations->invoke( this->_buffer );
+}
+
+
+inline Task::operator bool() const
+{
+    return this->_p_operations != nullptr;
+}
+
+
+inline bool Task::isInline() const
+{
+    return this->_p_operations && this->_p_operations->isInline;
+}
+
+
+inline void Task::reset()
+{
+    if ( this->_p_operations )
+    {
+        this->_p_operations->destroy( this->_buffer );
+        this->_p_operations = nullptr;
+    }
+}
+
+
+} // namespace cie::mp
+
+
+#endif
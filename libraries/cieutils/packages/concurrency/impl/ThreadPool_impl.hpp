@@ -0,0 +1,71 @@
+#ifndef CIE_UTILS_CONCURRENCY_THREAD_POOL_IMPL_HPP
+#define CIE_UTILS_CONCURRENCY_THREAD_POOL_IMPL_HPP
+
+// --- STL Includes ---
+#include <functional>
+#include <utility>
+
+
+namespace cie::mp {
+
+
+template <class FunctionType, class ...Args>
+inline JobHandle<ThreadPool::submit_result<FunctionType,Args...>>
+ThreadPool::submit( FunctionType&& r_function, Args&&... r_args )
+{
+    using result_type = ThreadPool::submit_result<FunctionType,Args...>;
+
+    auto p_state = std::make_shared<typename JobHandle<result_type>::state_type>();
+
+    this->queueJob(
+        [p_state, function = std::forward<FunctionType>(r_function), ...arguments = std::forward<Args>(r_args)]() mutable -> void
+        {
+            try
+            {
+                if constexpr ( std::is_void_v<result_type> )
+                    std::invoke( function, arguments... );
+                else
+                    p_state->result.emplace( std::invoke(function, arguments...) );
+            }
+            catch ( ... )
+            {
+                p_state->exception = std::current_exception();
+            }
+
+            p_state->done.store( true, std::memory_order_release );
+        }
+    );
+
+    return JobHandle<result_type>( p_state, *this );
+}
+
+
+template <class ...ResultTypes>
+inline void
+ThreadPool::waitFor( const JobHandle<ResultTypes>&... r_handles )
+{
+    const Size threadIndex = this->threadID();
+
+    while ( !(r_handles.done() && ...) )
+        if ( !this->executeJob(threadIndex, true) )
+            std::this_thread::yield();
+}
+
+
+template <concepts::STLContainer ContainerType>
+inline void
+ThreadPool::waitFor( const ContainerType& r_handles )
+{
+    const Size threadIndex = this->threadID();
+
+    for ( const auto& r_handle : r_handles )
+        while ( !r_handle.done() )
+            if ( !this->executeJob(threadIndex, true) )
+                std::this_thread::yield();
+}
+
+
+} // namespace cie::mp
+
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef CIE_UTILS_CONCURRENCY_CANCELLATION_TOKEN_HPP
+#define CIE_UTILS_CONCURRENCY_CANCELLATION_TOKEN_HPP
+
+// --- STL Includes ---
+#include <atomic>
+#include <memory>
+
+
+namespace cie::mp {
+
+
+/**
+ * @brief Shared flag for abandoning queued jobs.
+ * Copies of a token refer to the same flag, so every job queued
+ * with a copy is skipped once any of them is cancelled.
+ */
+class CancellationToken
+{
+public:
+    /// Create a new, uncancelled token
+    CancellationToken();
+
+    /// Mark all jobs sharing this token as cancelled
+    void cancel();
+
+    bool isCancelled() const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> _p_flag;
+};
+
+
+} // namespace cie::mp
+
+
+#endif
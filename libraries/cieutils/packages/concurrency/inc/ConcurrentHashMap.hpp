@@ -0,0 +1,122 @@
+#ifndef CIE_UTILS_CONCURRENCY_CONCURRENT_HASH_MAP_HPP
+#define CIE_UTILS_CONCURRENCY_CONCURRENT_HASH_MAP_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <unordered_map>
+#include <shared_mutex>
+#include <functional>
+#include <optional>
+#include <memory>
+#include <vector>
+
+
+namespace cie::mp {
+
+
+/**
+ * @brief Hash map safe for concurrent access, split into independently locked shards.
+ * Keys are distributed among the shards by their hash, each shard is an
+ * std::unordered_map guarded by its own reader-writer lock, so threads
+ * only contend if they access the same shard, and readers never block each other.
+ * @note values are returned by copy, since references could be invalidated
+ * by concurrent erasure.
+ */
+template < class KeyType,
+           class ValueType,
+           class HashType = std::hash<KeyType>,
+           class KeyEqual = std::equal_to<KeyType> >
+class ConcurrentHashMap
+{
+public:
+    using key_type    = KeyType;
+    using mapped_type = ValueType;
+    using hasher      = HashType;
+    using key_equal   = KeyEqual;
+    using map_type    = std::unordered_map<KeyType,ValueType,HashType,KeyEqual>;
+    using value_type  = typename map_type::value_type;
+    using mutex_type  = std::shared_mutex;
+
+public:
+    /// Create a map with at least 'numberOfShards' shards (rounded up to a power of 2)
+    ConcurrentHashMap( Size numberOfShards = 64,
+                       const HashType& r_hash = HashType() );
+
+    /// Insert a value if the key is not in the map yet
+    /// @return true if the value was inserted
+    template <class ...Args>
+    bool emplace( const KeyType& r_key, Args&&... r_args );
+
+    bool insert( const value_type& r_value );
+
+    /**
+     * @brief Insert a range of key-value pairs (existing keys are not overwritten).
+     * Each shard is locked only once for the whole range.
+     * @return number of inserted values
+     */
+    template <class InputIt>
+    Size insert( InputIt it_begin, InputIt it_end );
+
+    /// Insert or overwrite a value
+    template <class ValueArgument>
+    void insertOrAssign( const KeyType& r_key, ValueArgument&& r_value );
+
+    /**
+     * @brief Get the value of a key, or insert the result of 'r_generator' if it's not in the map.
+     * The generator is invoked without holding any locks, so it may run on several threads
+     * for the same key, but only the first result is stored (and returned to all callers).
+     */
+    template <class GeneratorType>
+    ValueType getOrInsert( const KeyType& r_key, GeneratorType&& r_generator );
+
+    std::optional<ValueType> find( const KeyType& r_key ) const;
+
+    bool contains( const KeyType& r_key ) const;
+
+    /// @return true if the key was in the map
+    bool erase( const KeyType& r_key );
+
+    /**
+     * @brief Erase a key only if its value satisfies 'r_predicate'
+     * (evaluated while the shard is locked, so the value can't change in between)
+     * @return true if the key was erased
+     */
+    template <class PredicateType>
+    bool eraseIf( const KeyType& r_key, PredicateType&& r_predicate );
+
+    void clear();
+
+    Size size() const;
+
+    bool empty() const;
+
+    Size numberOfShards() const;
+
+    /// Call 'r_function' on every key-value pair (shards are read-locked one at a time)
+    template <class FunctionType>
+    void forEach( FunctionType&& r_function ) const;
+
+private:
+    /// Map and its lock, padded to avoid false sharing
+    struct alignas(64) Shard
+    {
+        map_type           map;
+        mutable mutex_type mutex;
+    };
+
+    Size shardIndex( const KeyType& r_key ) const;
+
+private:
+    std::vector<std::unique_ptr<Shard>> _shards;
+    Size                                _mask;
+    HashType                            _hash;
+};
+
+
+} // namespace cie::mp
+
+#include "cieutils/packages/concurrency/impl/ConcurrentHashMap_impl.hpp"
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef CIE_UTILS_CONCURRENCY_JOB_HANDLE_HPP
+#define CIE_UTILS_CONCURRENCY_JOB_HANDLE_HPP
+
+// --- STL Includes ---
+#include <atomic>
+#include <optional>
+#include <exception>
+#include <memory>
+#include <type_traits>
+
+
+namespace cie::mp {
+
+
+class ThreadPool;
+
+
+namespace detail {
+
+/// Shared state between a submitted job and its handles
+template <class ResultType>
+struct JobState
+{
+    std::atomic<bool>           done      = false;
+    std::optional<ResultType>   result;
+    std::exception_ptr          exception = nullptr;
+};
+
+
+template <>
+struct JobState<void>
+{
+    std::atomic<bool>           done      = false;
+    std::exception_ptr          exception = nullptr;
+};
+
+
+template <class ResultType>
+struct JobResultReference
+{ using type = const ResultType&; };
+
+
+template <>
+struct JobResultReference<void>
+{ using type = void; };
+
+} // namespace detail
+
+
+/**
+ * @brief Lightweight future of a job submitted to a ThreadPool.
+ * Waiting on a handle does not block the calling thread: it executes
+ * queued jobs of the pool until the referenced job is done.
+ */
+template <class ResultType>
+class JobHandle
+{
+public:
+    using result_type     = ResultType;
+    using state_type      = detail::JobState<ResultType>;
+    using state_ptr       = std::shared_ptr<state_type>;
+    using const_reference = typename detail::JobResultReference<ResultType>::type;
+
+public:
+    JobHandle( state_ptr p_state, ThreadPool& r_pool );
+
+    /// Check whether the job has finished (without waiting)
+    bool done() const;
+
+    /// Execute queued jobs until this one is done
+    void wait() const;
+
+    /// Wait for the job and return its result (rethrows exceptions thrown by the job)
+    const_reference get() const;
+
+private:
+    state_ptr   _p_state;
+    ThreadPool* _p_pool;
+};
+
+
+} // namespace cie::mp
+
+
+#endif
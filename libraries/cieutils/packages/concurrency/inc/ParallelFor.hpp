@@ -4,18 +4,41 @@
 // --- Internal Includes ---
 #include "cieutils/packages/concurrency/inc/ThreadStorage.hpp"
 #include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolSingleton.hpp"
 #include "cieutils/packages/concepts/inc/container_concepts.hpp"
 #include "cieutils/packages/types/inc/types.hpp"
 
 // --- STL Includes ---
 #include <functional>
 #include <thread>
+#include <atomic>
 #include <vector>
 
 
 namespace cie::mp {
 
 
+/// Strategies for distributing loop iterations among threads
+enum class LoopSchedule
+{
+    Static,     ///< equal blocks per thread, or chunks assigned round-robin if a chunk size is set
+    Dynamic,    ///< threads grab chunks of fixed size (default 1) until the loop is exhausted
+    Guided      ///< threads grab chunks proportional to the remaining iterations, but at least the chunk size
+};
+
+
+namespace detail {
+
+/// Value padded to a full cache line to avoid false sharing between threads
+template <class ValueType>
+struct alignas(64) CacheLinePadded
+{
+    ValueType value;
+};
+
+} // namespace detail
+
+
 template < concepts::Integer IndexType = Size,
            class StorageType = ThreadStorage<IndexType> >
 class ParallelFor
@@ -31,8 +54,19 @@ public:
     static ParallelFor<IndexType,ThreadStorage<IndexType,Args...>>
     firstPrivate( Args&&... r_args );
 
+    /// Set the pool to execute the loop on (the default pool is used if none is set)
     ParallelFor<IndexType,StorageType>& setPool( ThreadPoolPtr p_pool );
 
+    /// Set the loop schedule and optionally its chunk size (0: default chunk size of the schedule)
+    ParallelFor<IndexType,StorageType>& setSchedule( LoopSchedule schedule,
+                                                     IndexType chunkSize = 0 );
+
+    ParallelFor<IndexType,StorageType>& setChunkSize( IndexType chunkSize );
+
+    LoopSchedule schedule() const;
+
+    IndexType chunkSize() const;
+
     void operator()( IndexType indexMin,
                      IndexType indexMax,
                      IndexType stepSize,
@@ -45,49 +79,62 @@ public:
     void operator()( ContainerType& r_container,
                      typename StorageType::object_loop_function<typename ContainerType::value_type>&& r_function );
 
-protected:
-    virtual index_partition makeIndexPartition( IndexType indexMin,
-                                                IndexType indexMax,
-                                                IndexType stepSize );
+    /**
+     * @brief Parallel reduction.
+     * Each thread accumulates into its own copy of 'r_identity' (passed to 'r_function'
+     * after the loop index), then the copies are merged with 'r_combine'.
+     * @note 'r_identity' must be the neutral element of 'r_combine'.
+     * @param r_combine binary function: ValueType( const ValueType&, const ValueType& )
+     * @param r_function loop body: void( IndexType, ValueType&, storage types&... )
+     */
+    template <class ValueType, class CombineFunction, class LoopFunction>
+    ValueType reduce( IndexType indexMin,
+                      IndexType indexMax,
+                      IndexType stepSize,
+                      const ValueType& r_identity,
+                      CombineFunction&& r_combine,
+                      LoopFunction&& r_function );
+
+    template <class ValueType, class CombineFunction, class LoopFunction>
+    ValueType reduce( IndexType indexMax,
+                      const ValueType& r_identity,
+                      CombineFunction&& r_combine,
+                      LoopFunction&& r_function );
 
-    void execute( const index_partition& r_indexPartition,
+protected:
+    /// Split [0,numberOfIterations) into 'numberOfBlocks' contiguous blocks (static schedule)
+    virtual index_partition makeIndexPartition( IndexType numberOfIterations,
+                                                IndexType numberOfBlocks );
+
+    /**
+     * @brief Distribute the loop among the threads of the pool and wait for it to finish.
+     * Each job gets its own copy of the storage, 'r_body' is called with the job index
+     * (smaller than the pool size), the loop index and references to the copied storage.
+     */
+    template <class LoopBody>
+    void execute( IndexType indexMin,
+                  IndexType indexMax,
                   IndexType stepSize,
-                  const typename StorageType::loop_function& r_function );
+                  const LoopBody& r_body );
 
-    template <concepts::STLContainer ContainerType>
-    void execute( const index_partition& r_indexPartition,
-                  IndexType stepSize,
-                  ContainerType& r_container,
-                  typename StorageType::object_loop_function<typename ContainerType::value_type>&& r_function );
+    /// Reserve the next chunk of a guided schedule
+    static bool nextGuidedChunk( std::atomic<IndexType>& r_counter,
+                                 IndexType numberOfIterations,
+                                 IndexType numberOfThreads,
+                                 IndexType minChunkSize,
+                                 IndexType& r_begin,
+                                 IndexType& r_end );
 
 private:
     StorageType            _storage;
     ThreadPoolPtr          _p_pool;
+    LoopSchedule           _schedule;
+    IndexType              _chunkSize;
 };
 
 
-
-
-
-namespace detail {
-
-template < concepts::Integer IndexType,
-           class StorageType >
-void loopChunk( IndexType indexMin,
-                IndexType indexMax,
-                IndexType stepSize )
-{
-
-}
-
-} // namespace detail
-
-
-
-
-
 } // namespace cie::mp
 
 #include "cieutils/packages/concurrency/impl/ParallelFor_impl.hpp"
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,66 @@
+#ifndef CIE_UTILS_CONCURRENCY_PRIORITY_JOB_QUEUE_HPP
+#define CIE_UTILS_CONCURRENCY_PRIORITY_JOB_QUEUE_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <vector>
+
+
+namespace cie::mp {
+
+
+/**
+ * @brief Job queue ordered by priority.
+ * Jobs with higher priority are popped first, jobs of equal
+ * priority are popped in the order they were pushed (FIFO).
+ * @note not thread safe, the owner is responsible for locking.
+ */
+template <class JobType>
+class PriorityJobQueue
+{
+public:
+    using job_type      = JobType;
+    using priority_type = Size;
+
+public:
+    PriorityJobQueue();
+
+    void push( job_type&& r_job, priority_type priority );
+
+    /// Move the job with the highest priority to 'r_job'
+    /// @return false if the queue is empty
+    bool pop( job_type& r_job );
+
+    /// Priority of the next job in the queue (0 if empty)
+    priority_type topPriority() const;
+
+    Size size() const;
+
+    bool empty() const;
+
+    void clear();
+
+private:
+    struct Entry
+    {
+        priority_type priority;
+        Size          index;
+        job_type      job;
+    };
+
+    /// Heap predicate: higher priority first, then lower insertion index
+    static bool compare( const Entry& r_lhs, const Entry& r_rhs );
+
+private:
+    std::vector<Entry> _heap;
+    Size               _counter;
+};
+
+
+} // namespace cie::mp
+
+#include "cieutils/packages/concurrency/impl/PriorityJobQueue_impl.hpp"
+
+#endif
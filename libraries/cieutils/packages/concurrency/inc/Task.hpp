@@ -0,0 +1,91 @@
+#ifndef CIE_UTILS_CONCURRENCY_TASK_HPP
+#define CIE_UTILS_CONCURRENCY_TASK_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <cstddef>
+#include <type_traits>
+
+
+namespace cie::mp {
+
+
+/**
+ * @brief Move-only wrapper for a callable with signature void().
+ * Callables that fit in the internal buffer (and can be moved without
+ * throwing) are stored in place, so wrapping small lambdas does not
+ * allocate. Larger callables are moved to the heap.
+ * @note unlike std::function, the wrapped callable need not be copyable.
+ */
+class Task
+{
+public:
+    static constexpr Size bufferSize = 48;
+
+    template <class FunctionType>
+    static constexpr bool storedInline = sizeof(FunctionType) <= bufferSize
+                                         && alignof(FunctionType) <= alignof(std::max_align_t)
+                                         && std::is_nothrow_move_constructible_v<FunctionType>;
+
+public:
+    /// Create an empty task
+    Task();
+
+    Task( std::nullptr_t );
+
+    template <class FunctionType>
+    requires (!std::is_same_v<std::decay_t<FunctionType>,Task>)
+             && std::is_invocable_v<std::decay_t<FunctionType>&>
+    Task( FunctionType&& r_function );
+
+    Task( Task&& r_rhs ) noexcept;
+
+    Task& operator=( Task&& r_rhs ) noexcept;
+
+    Task& operator=( std::nullptr_t );
+
+    ~Task();
+
+    /// Invoke the wrapped callable (the task must not be empty)
+    void operator()();
+
+    /// Check whether the task holds a callable
+    explicit operator bool() const;
+
+    /// Check whether the callable is stored in the internal buffer
+    bool isInline() const;
+
+private:
+    Task( const Task& r_rhs ) = delete;
+    Task& operator=( const Task& r_rhs ) = delete;
+
+    /// Type-erased operations on the stored callable
+    struct Operations
+    {
+        void (*invoke)( void* p_buffer );
+        void (*move)( void* p_source, void* p_target ); ///< move-construct into 'p_target' and destroy the source
+        void (*destroy)( void* p_buffer );
+        bool isInline;
+    };
+
+    template <class FunctionType>
+    static const Operations inlineOperations;
+
+    template <class FunctionType>
+    static const Operations heapOperations;
+
+    void reset();
+
+private:
+    alignas(std::max_align_t) std::byte _buffer[bufferSize];
+    const Operations*                   _p_operations;
+};
+
+
+} // namespace cie::mp
+
+#include "cieutils/packages/concurrency/impl/Task_impl.hpp"
+
+#endif
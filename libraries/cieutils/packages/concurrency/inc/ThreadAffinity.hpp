@@ -0,0 +1,64 @@
+#ifndef CIE_UTILS_CONCURRENCY_THREAD_AFFINITY_HPP
+#define CIE_UTILS_CONCURRENCY_THREAD_AFFINITY_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <string>
+
+
+namespace cie::mp {
+
+
+/**
+ * @brief Placement of threads on CPU cores.
+ * Thread i is pinned to core cores()[i % cores().size()], an empty
+ * core list leaves the threads unpinned.
+ * @note pinning is only supported on linux, it is silently skipped elsewhere.
+ */
+class ThreadAffinity
+{
+public:
+    using core_container = std::vector<Size>;
+
+public:
+    /// Do not pin threads
+    ThreadAffinity();
+
+    /// Pin threads to the specified cores in a round-robin fashion
+    ThreadAffinity( const core_container& r_cores );
+
+    /// Pin threads to all cores the process may run on
+    static ThreadAffinity allCores();
+
+    /// Pin threads to the cores of the specified NUMA node
+    static ThreadAffinity numaNode( Size nodeIndex );
+
+    /// Number of NUMA nodes on the system (1 if the topology is unknown)
+    static Size numberOfNUMANodes();
+
+    /// Cores belonging to a NUMA node
+    static core_container coresOfNUMANode( Size nodeIndex );
+
+    /// Parse a linux cpu list (eg.: "0-3,8,10-11")
+    static core_container parseCoreList( const std::string& r_coreList );
+
+    /// Pin the calling thread to the core assigned to 'threadIndex'
+    /// @return false if the threads are not pinned or pinning failed
+    bool apply( Size threadIndex ) const;
+
+    bool empty() const;
+
+    const core_container& cores() const;
+
+private:
+    core_container _cores;
+};
+
+
+} // namespace cie::mp
+
+
+#endif
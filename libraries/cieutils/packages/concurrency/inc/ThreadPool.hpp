@@ -2,16 +2,25 @@
 #define CIE_UTILS_CONCURRENCY_THREAD_POOL_HPP
 
 // --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/Task.hpp"
+#include "cieutils/packages/concurrency/inc/JobHandle.hpp"
+#include "cieutils/packages/concurrency/inc/PriorityJobQueue.hpp"
+#include "cieutils/packages/concurrency/inc/CancellationToken.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadAffinity.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolStatistics.hpp"
+#include "cieutils/packages/concepts/inc/container_concepts.hpp"
 #include "cieutils/packages/types/inc/types.hpp"
 
 // --- STL Includes ---
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
 #include <deque>
 #include <vector>
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 
 namespace cie::mp {
@@ -21,20 +30,36 @@ class ThreadPool
 {
 public:
     using thread_type      = std::thread;
-    using job_type         = std::function<void()>;
+    using job_type         = Task;
     using thread_container = std::vector<thread_type>;
     using job_container    = std::deque<job_type>;
+    using priority_type    = Size;
+    using priority_queue   = PriorityJobQueue<job_type>;
 
     using mutex_type       = std::mutex;
 
+    template <class FunctionType, class ...Args>
+    using submit_result    = std::invoke_result_t<std::decay_t<FunctionType>&,std::decay_t<Args>&...>;
+
+    /// Strategies for distributing jobs among threads
+    enum class Scheduling
+    {
+        Shared,         ///< one FIFO job queue shared by all threads
+        WorkStealing    ///< one job queue per thread, idle threads steal from the others
+    };
+
 public:
     /// Create a thread pool with 'size' threads
     /**
      * @note 'size' must be positive and not greater than the maximum number
      * of threads on the system. The number of threads is capped at the supported
      * max.
+     * @note threads pin themselves to cores according to 'r_affinity' before
+     * executing any jobs, so memory they allocate is local to their NUMA node.
      */
-    ThreadPool( Size size );
+    ThreadPool( Size size,
+                Scheduling scheduling = Scheduling::WorkStealing,
+                const ThreadAffinity& r_affinity = ThreadAffinity() );
 
     /// Create a thread pool with the maximum number of threads the system supports
     ThreadPool();
@@ -44,15 +69,72 @@ public:
     static Size maxNumberOfThreads();
 
     /// Queue a job for execution
+    /**
+     * @note in work-stealing mode, jobs queued from a thread of the pool
+     * are pushed to that thread's own queue, while jobs from other threads
+     * are distributed among the queues in a round-robin fashion.
+     * @note small callables are stored in place (see @ref Task), so
+     * queueing them does not allocate.
+     */
     void queueJob( job_type job );
 
+    /// Queue a job that is executed before all jobs with lower priority
+    /**
+     * @note priority 0 is the default and goes through the regular queues,
+     * jobs with positive priorities are stripped before any of those.
+     */
+    void queueJob( job_type job,
+                   priority_type priority );
+
+    /// Queue a job that is dropped if the token is cancelled before the job starts
+    void queueJob( job_type job,
+                   const CancellationToken& r_token,
+                   priority_type priority = 0 );
+
+    /// Queue a function call for execution and get a handle to its result
+    /**
+     * @note the function and its arguments are copied/moved into the job
+     */
+    template <class FunctionType, class ...Args>
+    JobHandle<submit_result<FunctionType,Args...>> submit( FunctionType&& r_function,
+                                                           Args&&... r_args );
+
+    /// Execute queued jobs on the calling thread until all specified jobs are done
+    /**
+     * @note unlike @ref barrier, this does not wait for unrelated jobs, and
+     * can be called from within jobs of this pool.
+     * @note the waiting thread executes the newest jobs first. Those are usually
+     * queued by the jobs it waits for, so recursively waiting jobs nest about
+     * as deep as their recursion instead of as wide as the queue.
+     */
+    template <class ...ResultTypes>
+    void waitFor( const JobHandle<ResultTypes>&... r_handles );
+
+    /// Execute queued jobs on the calling thread until all jobs in the container are done
+    template <concepts::STLContainer ContainerType>
+    void waitFor( const ContainerType& r_handles );
+
     /// Number of threads in the pool
     Size size() const;
 
     /// Number of jobs in the queue
     Size numberOfJobs() const;
 
-    /// TODO
+    Scheduling scheduling() const;
+
+    const ThreadAffinity& affinity() const;
+
+    /// Get a snapshot of the per-thread utilization counters
+    /**
+     * @note the counters are only collected if CIE_ENABLE_THREAD_POOL_STATISTICS
+     * is defined, otherwise they cost nothing and are all 0.
+     */
+    ThreadPoolStatistics statistics() const;
+
+    /// Set all utilization counters to 0
+    void resetStatistics();
+
+    /// Block until all queued jobs (including the ones they queue) are finished
     void barrier();
 
     void terminate();
@@ -64,24 +146,75 @@ private:
 
     /**
      * @brief Looping function running on all threads
-     * Upon notification, sets the lock and checks the job queue,
-     * strips and executes one if there are any.
+     * Strips and executes jobs from the queues as long as there are any,
+     * and sleeps until notified otherwise.
+     */
+    void jobScheduler( Size threadIndex );
+
+    /**
+     * @brief Strip a job from the queues
+     * Prioritized jobs are checked first, then the thread's own queue (newest job), then
+     * the other queues are scanned (oldest job, or newest if 'newestFirst' is set).
+     * Threads outside the pool ('threadIndex' >= size) have no own queue.
+     * @return false if no job was found
+     */
+    bool popJob( Size threadIndex, job_type& r_job, bool newestFirst = false );
+
+    /**
+     * @brief Strip a job from the queues and execute it on the calling thread
+     * @return false if no job was found
      */
-    void jobScheduler();
+    bool executeJob( Size threadIndex, bool newestFirst = false );
 
+    /// Index of the queue a new job should be pushed to
+    Size pushIndex();
+
+    /// Wake up a sleeping thread after a job was queued
+    void notifyIdleThread();
+
+    /// Index of the calling thread in this pool (size() for threads outside the pool)
     Size threadID() const;
 
+    /// Utilization counters of a thread (threads outside the pool share the last entry)
+    detail::WorkerCounters& counters( Size threadIndex );
+
+    /// Lock a queue, measuring the time spent waiting if the lock is contended
+    std::unique_lock<mutex_type> lockQueue( mutex_type& r_mutex, Size threadIndex );
+
 private:
+    /// Job queue with its own lock, padded to avoid false sharing
+    struct alignas(64) JobQueue
+    {
+        job_container jobs;
+        mutex_type    mutex;
+    };
+
+    using queue_container = std::vector<std::unique_ptr<JobQueue>>;
+
+    using counter_container = std::vector<std::unique_ptr<detail::WorkerCounters>>;
+
+private:
+    const Scheduling        _scheduling;
+    const ThreadAffinity    _affinity;
     bool                    _terminate;
     thread_container        _threads;
-    job_container           _jobs;
+    queue_container         _queues;
+    counter_container       _counters;
+    priority_queue          _priorityJobs;
+    mutex_type              _priorityMutex;
     mutex_type              _mutex;
     std::condition_variable _jobCondition;
-    std::condition_variable _barrierCondition;
     std::condition_variable _masterCondition;
 
-    Size                    _numberOfActiveThreads;
-    bool                    _barrier;
+    std::atomic<Size>       _numberOfQueuedJobs;
+    std::atomic<Size>       _numberOfPriorityJobs;
+    std::atomic<Size>       _numberOfPendingJobs;
+    std::atomic<Size>       _numberOfIdleThreads;
+    std::atomic<Size>       _pushCounter;
+
+    /// Pool the calling thread belongs to (set once by the thread itself)
+    static thread_local const ThreadPool* _p_currentPool;
+    static thread_local Size              _currentThreadIndex;
 };
 
 
@@ -90,5 +223,7 @@ using ThreadPoolPtr = std::shared_ptr<ThreadPool>;
 
 } // namespace cie::mp
 
+#include "cieutils/packages/concurrency/impl/ThreadPool_impl.hpp"
+#include "cieutils/packages/concurrency/impl/JobHandle_impl.hpp"
 
-#endif
\ No newline at end of file
+#endif
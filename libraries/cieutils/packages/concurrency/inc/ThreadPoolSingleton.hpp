@@ -0,0 +1,48 @@
+#ifndef CIE_UTILS_CONCURRENCY_THREAD_POOL_SINGLETON_HPP
+#define CIE_UTILS_CONCURRENCY_THREAD_POOL_SINGLETON_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <mutex>
+
+
+namespace cie::mp {
+
+
+/**
+ * @brief Process-wide default thread pool.
+ * The pool is started on first access and shared by every API
+ * that is not given an explicit pool, so repeated calls pay no
+ * thread startup cost and the number of threads stays bounded.
+ */
+class ThreadPoolSingleton
+{
+public:
+    static ThreadPool& get();
+
+    static ThreadPoolPtr getPtr();
+
+    /// Set the number of threads of the default pool
+    /// @note must be called before the pool is started (first access)
+    static void setSize( Size size );
+
+    /// Number of threads the default pool has (or will have once started)
+    static Size size();
+
+    /// Check whether the default pool was started already
+    static bool isStarted();
+
+private:
+    static ThreadPoolPtr _p_pool;
+    static Size          _size;
+    static std::mutex    _mutex;
+};
+
+
+} // namespace cie::mp
+
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef CIE_UTILS_CONCURRENCY_THREAD_POOL_STATISTICS_HPP
+#define CIE_UTILS_CONCURRENCY_THREAD_POOL_STATISTICS_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <ostream>
+
+
+namespace cie::mp {
+
+
+/// Utilization counters of a single thread of a ThreadPool
+struct WorkerStatistics
+{
+    Size   numberOfJobs       = 0;   ///< executed jobs
+    Size   numberOfStolenJobs = 0;   ///< executed jobs taken from other threads' queues
+    double busyTime           = 0.0; ///< [s] spent executing jobs
+    double idleTime           = 0.0; ///< [s] spent sleeping while no jobs were queued
+    double lockWaitTime       = 0.0; ///< [s] spent waiting for contended queue locks
+    Size   queueHighWaterMark = 0;   ///< max number of jobs in the thread's own queue
+
+    WorkerStatistics& operator+=( const WorkerStatistics& r_rhs );
+};
+
+
+/**
+ * @brief Snapshot of the utilization counters of a ThreadPool.
+ * Threads outside the pool that execute jobs while waiting for them
+ * (see ThreadPool::waitFor) are accumulated in 'external'.
+ * @note counters are only collected if CIE_ENABLE_THREAD_POOL_STATISTICS
+ * is defined, otherwise all of them stay 0.
+ */
+struct ThreadPoolStatistics
+{
+    std::vector<WorkerStatistics> workers;
+    WorkerStatistics              external;
+
+    /// Sum of the counters of all workers and external threads (the high-water mark is the max)
+    WorkerStatistics total() const;
+
+    /// Busy time over the total (busy + idle) time of the workers
+    double utilization() const;
+};
+
+
+std::ostream& operator<<( std::ostream& r_stream, const WorkerStatistics& r_statistics );
+
+/// Write a table with one row per thread (can be dumped to utils::Logger via operator<<)
+std::ostream& operator<<( std::ostream& r_stream, const ThreadPoolStatistics& r_statistics );
+
+
+namespace detail {
+
+
+/**
+ * @brief Counters updated by a single thread of a ThreadPool.
+ * Padded to avoid false sharing between workers, times are stored in nanoseconds.
+ */
+struct alignas(64) WorkerCounters
+{
+    using clock_type = std::chrono::steady_clock;
+
+    std::atomic<Size> numberOfJobs       = 0;
+    std::atomic<Size> numberOfStolenJobs = 0;
+    std::atomic<Size> busyTime           = 0;
+    std::atomic<Size> idleTime           = 0;
+    std::atomic<Size> lockWaitTime       = 0;
+    std::atomic<Size> queueHighWaterMark = 0;
+
+    /// Nanoseconds elapsed since 'begin'
+    static Size elapsed( clock_type::time_point begin );
+
+    void updateHighWaterMark( Size queueSize );
+
+    WorkerStatistics snapshot() const;
+
+    void reset();
+};
+
+
+} // namespace detail
+
+
+} // namespace cie::mp
+
+
+#endif
@@ -0,0 +1,26 @@
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/CancellationToken.hpp"
+
+
+namespace cie::mp {
+
+
+CancellationToken::CancellationToken() :
+    _p_flag( new std::atomic<bool>(false) )
+{
+}
+
+
+void CancellationToken::cancel()
+{
+    this->_p_flag->store( true, std::memory_order_release );
+}
+
+
+bool CancellationToken::isCancelled() const
+{
+    return this->_p_flag->load( std::memory_order_acquire );
+}
+
+
+} // namespace cie::mp
@@ -0,0 +1,181 @@
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadAffinity.hpp"
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace cie::mp {
+
+
+namespace {
+const std::filesystem::path NUMA_NODE_DIRECTORY = "/sys/devices/system/node";
+} // anonymous namespace
+
+
+ThreadAffinity::ThreadAffinity() :
+    _cores()
+{
+}
+
+
+ThreadAffinity::ThreadAffinity( const ThreadAffinity::core_container& r_cores ) :
+    _cores( r_cores )
+{
+}
+
+
+ThreadAffinity ThreadAffinity::allCores()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    ThreadAffinity::core_container cores;
+
+    #ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO( &cpuSet );
+
+    if ( sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) == 0 )
+        for ( Size core=0; core<CPU_SETSIZE; ++core )
+            if ( CPU_ISSET(core, &cpuSet) )
+                cores.push_back( core );
+    #endif
+
+    if ( cores.empty() )
+        for ( Size core=0; core<std::thread::hardware_concurrency(); ++core )
+            cores.push_back( core );
+
+    return ThreadAffinity( cores );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+ThreadAffinity ThreadAffinity::numaNode( Size nodeIndex )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return ThreadAffinity( ThreadAffinity::coresOfNUMANode(nodeIndex) );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+Size ThreadAffinity::numberOfNUMANodes()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Size numberOfNodes = 0;
+
+    while ( std::filesystem::exists(NUMA_NODE_DIRECTORY / ("node" + std::to_string(numberOfNodes))) )
+        ++numberOfNodes;
+
+    return numberOfNodes ? numberOfNodes : 1;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+ThreadAffinity::core_container ThreadAffinity::coresOfNUMANode( Size nodeIndex )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto coreListPath = NUMA_NODE_DIRECTORY / ("node" + std::to_string(nodeIndex)) / "cpulist";
+
+    // Unknown topology -> treat the system as a single node
+    if ( !std::filesystem::exists(coreListPath) )
+    {
+        if ( nodeIndex == 0 )
+            return ThreadAffinity::allCores().cores();
+        else
+            CIE_THROW( OutOfRangeException, "NUMA node " + std::to_string(nodeIndex) + " does not exist" )
+    }
+
+    std::ifstream file( coreListPath );
+    std::string coreList;
+    std::getline( file, coreList );
+
+    return ThreadAffinity::parseCoreList( coreList );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+ThreadAffinity::core_container ThreadAffinity::parseCoreList( const std::string& r_coreList )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    ThreadAffinity::core_container cores;
+
+    std::stringstream stream( r_coreList );
+    std::string range;
+
+    while ( std::getline(stream, range, ',') )
+    {
+        if ( range.find_first_not_of(" \t\n") == range.npos )
+            continue;
+
+        const auto separatorPosition = range.find( '-' );
+
+        if ( separatorPosition == range.npos )
+            cores.push_back( std::stoul(range) );
+        else
+        {
+            Size begin = std::stoul( range.substr(0, separatorPosition) );
+            Size end   = std::stoul( range.substr(separatorPosition + 1) );
+
+            for ( Size core=begin; core<=end; ++core )
+                cores.push_back( core );
+        }
+    }
+
+    return cores;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+bool ThreadAffinity::apply( Size threadIndex ) const
+{
+    if ( this->_cores.empty() )
+        return false;
+
+    #ifdef __linux__
+    const Size core = this->_cores[threadIndex % this->_cores.size()];
+
+    if ( CPU_SETSIZE <= core )
+        return false;
+
+    cpu_set_t cpuSet;
+    CPU_ZERO( &cpuSet );
+    CPU_SET( core, &cpuSet );
+
+    return pthread_setaffinity_np( pthread_self(), sizeof(cpu_set_t), &cpuSet ) == 0;
+    #else
+    return false;
+    #endif
+}
+
+
+bool ThreadAffinity::empty() const
+{
+    return this->_cores.empty();
+}
+
+
+const ThreadAffinity::core_container& ThreadAffinity::cores() const
+{
+    return this->_cores;
+}
+
+
+} // namespace cie::mp
@@ -3,12 +3,29 @@
 #include "cieutils/packages/macros/inc/checks.hpp"
 #include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
 
+// --- STL Includes ---
+#include <algorithm>
+
 
 namespace cie::mp {
 
 
-ThreadPool::ThreadPool( Size size ) :
-    _terminate( false )
+thread_local const ThreadPool* ThreadPool::_p_currentPool = nullptr;
+
+thread_local Size ThreadPool::_currentThreadIndex = 0;
+
+
+ThreadPool::ThreadPool( Size size,
+                        ThreadPool::Scheduling scheduling,
+                        const ThreadAffinity& r_affinity ) :
+    _scheduling( scheduling ),
+    _affinity( r_affinity ),
+    _terminate( false ),
+    _numberOfQueuedJobs( 0 ),
+    _numberOfPriorityJobs( 0 ),
+    _numberOfPendingJobs( 0 ),
+    _numberOfIdleThreads( 0 ),
+    _pushCounter( 0 )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
@@ -16,20 +33,30 @@ ThreadPool::ThreadPool( Size size ) :
         CIE_THROW( Exception, "Cannot create thread pool of size 0!" )
 
     Size maxNumberOfThreads = ThreadPool::maxNumberOfThreads();
-    
+
     if ( maxNumberOfThreads == 0 )
         maxNumberOfThreads = 1;
 
     if ( maxNumberOfThreads < size )
         size = maxNumberOfThreads;
 
-    _barrier = false;
+    // Initialize queues (one shared, or one per thread)
+    Size numberOfQueues = this->_scheduling == Scheduling::WorkStealing ? size : 1;
+
+    this->_queues.reserve( numberOfQueues );
+    for ( Size i=0; i<numberOfQueues; ++i )
+        this->_queues.emplace_back( new JobQueue );
+
+    // Initialize counters (+1 for threads outside the pool)
+    this->_counters.reserve( size + 1 );
+    for ( Size i=0; i<size+1; ++i )
+        this->_counters.emplace_back( new detail::WorkerCounters );
 
     // Initialize threads
     this->_threads.reserve( size );
 
-    for ( _numberOfActiveThreads=0; _numberOfActiveThreads<size; ++_numberOfActiveThreads )
-        this->_threads.push_back( std::thread(&ThreadPool::jobScheduler, this) );
+    for ( Size i=0; i<size; ++i )
+        this->_threads.emplace_back( &ThreadPool::jobScheduler, this, i );
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -55,11 +82,60 @@ Size ThreadPool::maxNumberOfThreads()
 
 void ThreadPool::queueJob( ThreadPool::job_type job )
 {
+    // Register the job before it becomes visible to the threads,
+    // so the counters never underflow
+    ++this->_numberOfPendingJobs;
+    ++this->_numberOfQueuedJobs;
+
     {
-        std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
-        this->_jobs.push_back( job );
+        const Size threadIndex = this->threadID();
+        const Size queueIndex  = this->pushIndex();
+
+        auto& r_queue = *this->_queues[queueIndex];
+        auto lock = this->lockQueue( r_queue.mutex, threadIndex );
+        r_queue.jobs.push_back( std::move(job) );
+
+        #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+        this->counters( queueIndex ).updateHighWaterMark( r_queue.jobs.size() );
+        #endif
     }
-    this->_jobCondition.notify_one();
+
+    this->notifyIdleThread();
+}
+
+
+void ThreadPool::queueJob( ThreadPool::job_type job,
+                           ThreadPool::priority_type priority )
+{
+    if ( priority == 0 )
+        return this->queueJob( std::move(job) );
+
+    ++this->_numberOfPendingJobs;
+    ++this->_numberOfQueuedJobs;
+
+    {
+        auto lock = this->lockQueue( this->_priorityMutex, this->threadID() );
+        this->_priorityJobs.push( std::move(job), priority );
+        ++this->_numberOfPriorityJobs;
+    }
+
+    this->notifyIdleThread();
+}
+
+
+void ThreadPool::queueJob( ThreadPool::job_type job,
+                           const CancellationToken& r_token,
+                           ThreadPool::priority_type priority )
+{
+    // Cancelled jobs are still stripped from the queues, but do nothing
+    this->queueJob(
+        [job = std::move(job), token = r_token]() mutable -> void
+        {
+            if ( !token.isCancelled() )
+                job();
+        },
+        priority
+    );
 }
 
 
@@ -71,38 +147,58 @@ Size ThreadPool::size() const
 
 Size ThreadPool::numberOfJobs() const
 {
-    return this->_jobs.size();
+    return this->_numberOfQueuedJobs;
 }
 
 
-void ThreadPool::barrier()
+ThreadPool::Scheduling ThreadPool::scheduling() const
+{
+    return this->_scheduling;
+}
+
+
+const ThreadAffinity& ThreadPool::affinity() const
+{
+    return this->_affinity;
+}
+
+
+ThreadPoolStatistics ThreadPool::statistics() const
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
-    
-    CIE_CHECK(
-        !this->_barrier,
-        "barrier was called on an ongoing barrier!"
-    )
+    ThreadPoolStatistics statistics;
 
-    this->_masterCondition.wait(
-        lock,
-        [this]{ return this->_numberOfActiveThreads == this->_threads.size(); }
-    );
+    statistics.workers.reserve( this->_counters.size() - 1 );
+    for ( Size i=0; i<this->_counters.size()-1; ++i )
+        statistics.workers.push_back( this->_counters[i]->snapshot() );
+
+    statistics.external = this->_counters.back()->snapshot();
 
-    this->_barrier = true;
+    return statistics;
+
+    CIE_END_EXCEPTION_TRACING
+}
 
-    this->_jobCondition.notify_all();
+
+void ThreadPool::resetStatistics()
+{
+    for ( auto& rp_counters : this->_counters )
+        rp_counters->reset();
+}
+
+
+void ThreadPool::barrier()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
 
     this->_masterCondition.wait(
         lock,
-        [this]{ return (this->_terminate) || (this->_numberOfActiveThreads == 0); }
+        [this]{ return (this->_terminate) || (this->_numberOfPendingJobs == 0); }
     );
 
-    this->_barrier = false;
-    this->_barrierCondition.notify_all();
-
     CIE_END_EXCEPTION_TRACING
 }
 
@@ -113,7 +209,7 @@ void ThreadPool::terminate()
         std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
         this->_terminate = true;
         this->_jobCondition.notify_all();
-        this->_barrierCondition.notify_all();
+        this->_masterCondition.notify_all();
     }
 
     for ( auto& r_thread : this->_threads )
@@ -123,81 +219,219 @@ void ThreadPool::terminate()
 }
 
 
-void ThreadPool::jobScheduler()
+void ThreadPool::jobScheduler( Size threadIndex )
 {
-    auto id = this->threadID();
+    ThreadPool::_p_currentPool      = this;
+    ThreadPool::_currentThreadIndex = threadIndex;
+
+    this->_affinity.apply( threadIndex );
 
     while ( true )
     {
-        ThreadPool::job_type job = nullptr;
+        // Got a job? -> execute it!
+        if ( this->executeJob(threadIndex) )
+            continue;
 
-        {
-            std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
+        // Don't have a job? -> terminate or sleep until there is one
+        std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
 
-            this->_jobCondition.wait(
-                lock,
-                [this]{ return !this->_jobs.empty() || this->_terminate || this->_barrier; }
-            );
+        #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+        const auto idleBegin = detail::WorkerCounters::clock_type::now();
+        #endif
 
-            // Got a job? -> strip it!
-            if ( !this->_jobs.empty() )
+        ++this->_numberOfIdleThreads;
+        this->_jobCondition.wait(
+            lock,
+            [this]{ return this->_numberOfQueuedJobs || this->_terminate; }
+        );
+        --this->_numberOfIdleThreads;
+
+        #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+        this->counters( threadIndex ).idleTime.fetch_add( detail::WorkerCounters::elapsed(idleBegin), std::memory_order_relaxed );
+        #endif
+
+        // Terminate thread only after the queues are drained
+        if ( this->_terminate && !this->_numberOfQueuedJobs )
+            break;
+    }
+}
+
+
+bool ThreadPool::popJob( Size threadIndex, ThreadPool::job_type& r_job, bool newestFirst )
+{
+    const Size numberOfQueues = this->_queues.size();
+
+    // Prioritized jobs first (skip locking if there are none)
+    if ( this->_numberOfPriorityJobs )
+    {
+        auto lock = this->lockQueue( this->_priorityMutex, threadIndex );
+        if ( this->_priorityJobs.pop(r_job) )
+        {
+            --this->_numberOfPriorityJobs;
+            --this->_numberOfQueuedJobs;
+            return true;
+        }
+    }
+
+    if ( this->_scheduling == Scheduling::WorkStealing )
+    {
+        // Own queue: take the newest job
+        if ( threadIndex < numberOfQueues )
+        {
+            auto& r_queue = *this->_queues[threadIndex];
+            auto lock = this->lockQueue( r_queue.mutex, threadIndex );
+            if ( !r_queue.jobs.empty() )
             {
-                job = this->_jobs.front();
-                this->_jobs.pop_front();
+                r_job = std::move( r_queue.jobs.back() );
+                r_queue.jobs.pop_back();
+                --this->_numberOfQueuedJobs;
+                return true;
             }
         }
 
-        // Have a stripped job? -> execute it!
-        if ( job )
-            job();
+        // Steal the oldest job from another queue
+        for ( Size offset=0; offset<numberOfQueues; ++offset )
+        {
+            const Size queueIndex = (threadIndex + offset) % numberOfQueues;
+            if ( queueIndex == threadIndex )
+                continue;
 
-        // Don't have a stripped job? -> terminate or set blocked for barrier
-        else
+            auto& r_queue = *this->_queues[queueIndex];
+            auto lock = this->lockQueue( r_queue.mutex, threadIndex );
+            if ( !r_queue.jobs.empty() )
+            {
+                if ( newestFirst )
+                {
+                    r_job = std::move( r_queue.jobs.back() );
+                    r_queue.jobs.pop_back();
+                }
+                else
+                {
+                    r_job = std::move( r_queue.jobs.front() );
+                    r_queue.jobs.pop_front();
+                }
+                --this->_numberOfQueuedJobs;
+
+                #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+                this->counters( threadIndex ).numberOfStolenJobs.fetch_add( 1, std::memory_order_relaxed );
+                #endif
+
+                return true;
+            }
+        }
+    }
+    else
+    {
+        auto& r_queue = *this->_queues.front();
+        auto lock = this->lockQueue( r_queue.mutex, threadIndex );
+        if ( !r_queue.jobs.empty() )
         {
-            std::unique_lock<ThreadPool::mutex_type> lock( this->_mutex );
+            if ( newestFirst )
+            {
+                r_job = std::move( r_queue.jobs.back() );
+                r_queue.jobs.pop_back();
+            }
+            else
+            {
+                r_job = std::move( r_queue.jobs.front() );
+                r_queue.jobs.pop_front();
+            }
+            --this->_numberOfQueuedJobs;
+            return true;
+        }
+    }
 
-            // Terminate thread
-            if ( this->_terminate )
-                break;
+    return false;
+}
 
-            // Enqueue at barrier
-            else if ( this->_barrier )
-            {
-                if ( this->_numberOfActiveThreads )
-                    --this->_numberOfActiveThreads;
 
-                this->_masterCondition.notify_all();
+bool ThreadPool::executeJob( Size threadIndex, bool newestFirst )
+{
+    ThreadPool::job_type job;
+
+    if ( !this->popJob(threadIndex, job, newestFirst) )
+        return false;
+
+    #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+    const auto busyBegin = detail::WorkerCounters::clock_type::now();
+    job();
+    auto& r_counters = this->counters( threadIndex );
+    r_counters.busyTime.fetch_add( detail::WorkerCounters::elapsed(busyBegin), std::memory_order_relaxed );
+    r_counters.numberOfJobs.fetch_add( 1, std::memory_order_relaxed );
+    #else
+    job();
+    #endif
+
+    // Wake up threads waiting at a barrier if this was the last job
+    if ( --this->_numberOfPendingJobs == 0 )
+    {
+        std::scoped_lock<ThreadPool::mutex_type> lock( this->_mutex );
+        this->_masterCondition.notify_all();
+    }
 
-                this->_barrierCondition.wait(
-                    lock,
-                    [this]{ return (!this->_barrier) || this->_terminate; }
-                );
+    return true;
+}
 
-                ++this->_numberOfActiveThreads;
-                this->_masterCondition.notify_all();
-            }
-            else
-                CIE_THROW( Exception, "Thread has no job, no barrier, and is not terminated" )
-        } // job queue empty
+
+Size ThreadPool::pushIndex()
+{
+    if ( this->_scheduling == Scheduling::Shared )
+        return 0;
+
+    // Threads of the pool push to their own queue
+    Size id = this->threadID();
+    if ( id < this->_queues.size() )
+        return id;
+
+    // Other threads distribute the jobs evenly
+    return this->_pushCounter++ % this->_queues.size();
+}
+
+
+void ThreadPool::notifyIdleThread()
+{
+    // Only touch the global lock if a thread might be sleeping
+    if ( this->_numberOfIdleThreads )
+    {
+        { std::scoped_lock<ThreadPool::mutex_type> lock( this->_mutex ); }
+        this->_jobCondition.notify_one();
     }
 }
 
 
 Size ThreadPool::threadID() const
 {
-    CIE_BEGIN_EXCEPTION_TRACING
+    if ( ThreadPool::_p_currentPool == this )
+        return ThreadPool::_currentThreadIndex;
+
+    return this->_threads.size();
+}
+
 
-    auto it_threadEnd = this->_threads.end();
-    auto id = std::this_thread::get_id();
+detail::WorkerCounters& ThreadPool::counters( Size threadIndex )
+{
+    return *this->_counters[std::min( threadIndex, this->_counters.size() - 1 )];
+}
 
-    for ( auto it=this->_threads.begin(); it!=it_threadEnd; ++it )
-        if ( it->get_id() == id )
-            return std::distance( this->_threads.begin(), it );
 
-    return std::distance( this->_threads.begin(), it_threadEnd );
+std::unique_lock<ThreadPool::mutex_type> ThreadPool::lockQueue( ThreadPool::mutex_type& r_mutex,
+                                                                 [[maybe_unused]] Size threadIndex )
+{
+    #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+    std::unique_lock<ThreadPool::mutex_type> lock( r_mutex, std::try_to_lock );
 
-    CIE_END_EXCEPTION_TRACING
+    if ( !lock.owns_lock() )
+    {
+        const auto begin = detail::WorkerCounters::clock_type::now();
+        lock.lock();
+        this->counters( threadIndex ).lockWaitTime.fetch_add( detail::WorkerCounters::elapsed(begin), std::memory_order_relaxed );
+    }
+
+    return lock;
+    #else
+    return std::unique_lock<ThreadPool::mutex_type>( r_mutex );
+    #endif
 }
 
 
-} // namespace cie::mp
\ No newline at end of file
+} // namespace cie::mp
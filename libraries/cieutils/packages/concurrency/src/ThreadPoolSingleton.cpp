@@ -0,0 +1,66 @@
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadPoolSingleton.hpp"
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+
+namespace cie::mp {
+
+
+ThreadPoolPtr ThreadPoolSingleton::_p_pool = nullptr;
+
+Size ThreadPoolSingleton::_size = 0;
+
+std::mutex ThreadPoolSingleton::_mutex;
+
+
+ThreadPool& ThreadPoolSingleton::get()
+{
+    return *ThreadPoolSingleton::getPtr();
+}
+
+
+ThreadPoolPtr ThreadPoolSingleton::getPtr()
+{
+    std::scoped_lock<std::mutex> lock( ThreadPoolSingleton::_mutex );
+
+    if ( !ThreadPoolSingleton::_p_pool )
+        ThreadPoolSingleton::_p_pool.reset( ThreadPoolSingleton::_size ? new ThreadPool(ThreadPoolSingleton::_size) : new ThreadPool );
+
+    return ThreadPoolSingleton::_p_pool;
+}
+
+
+void ThreadPoolSingleton::setSize( Size size )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::scoped_lock<std::mutex> lock( ThreadPoolSingleton::_mutex );
+
+    if ( ThreadPoolSingleton::_p_pool )
+        CIE_THROW( Exception, "The default thread pool is already running" )
+
+    ThreadPoolSingleton::_size = size;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+Size ThreadPoolSingleton::size()
+{
+    std::scoped_lock<std::mutex> lock( ThreadPoolSingleton::_mutex );
+
+    if ( ThreadPoolSingleton::_p_pool )
+        return ThreadPoolSingleton::_p_pool->size();
+
+    return ThreadPoolSingleton::_size ? ThreadPoolSingleton::_size : ThreadPool::maxNumberOfThreads();
+}
+
+
+bool ThreadPoolSingleton::isStarted()
+{
+    std::scoped_lock<std::mutex> lock( ThreadPoolSingleton::_mutex );
+    return bool( ThreadPoolSingleton::_p_pool );
+}
+
+
+} // namespace cie::mp
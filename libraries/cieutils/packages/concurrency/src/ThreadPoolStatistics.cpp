@@ -0,0 +1,146 @@
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadPoolStatistics.hpp"
+
+// --- STL Includes ---
+#include <algorithm>
+#include <iomanip>
+
+
+namespace cie::mp {
+
+
+WorkerStatistics& WorkerStatistics::operator+=( const WorkerStatistics& r_rhs )
+{
+    this->numberOfJobs       += r_rhs.numberOfJobs;
+    this->numberOfStolenJobs += r_rhs.numberOfStolenJobs;
+    this->busyTime           += r_rhs.busyTime;
+    this->idleTime           += r_rhs.idleTime;
+    this->lockWaitTime       += r_rhs.lockWaitTime;
+    this->queueHighWaterMark  = std::max( this->queueHighWaterMark, r_rhs.queueHighWaterMark );
+    return *this;
+}
+
+
+WorkerStatistics ThreadPoolStatistics::total() const
+{
+    WorkerStatistics total = this->external;
+
+    for ( const auto& r_worker : this->workers )
+        total += r_worker;
+
+    return total;
+}
+
+
+double ThreadPoolStatistics::utilization() const
+{
+    double busyTime = 0.0;
+    double idleTime = 0.0;
+
+    for ( const auto& r_worker : this->workers )
+    {
+        busyTime += r_worker.busyTime;
+        idleTime += r_worker.idleTime;
+    }
+
+    return 0.0 < busyTime + idleTime ? busyTime / (busyTime + idleTime) : 0.0;
+}
+
+
+std::ostream& operator<<( std::ostream& r_stream, const WorkerStatistics& r_statistics )
+{
+    const auto flags     = r_stream.flags();
+    const auto precision = r_stream.precision();
+
+    r_stream << std::setw(10) << r_statistics.numberOfJobs
+             << std::setw(10) << r_statistics.numberOfStolenJobs
+             << std::setw(12) << std::fixed << std::setprecision(4) << r_statistics.busyTime
+             << std::setw(12) << r_statistics.idleTime
+             << std::setw(12) << r_statistics.lockWaitTime
+             << std::setw(10) << r_statistics.queueHighWaterMark;
+
+    r_stream.flags( flags );
+    r_stream.precision( precision );
+    return r_stream;
+}
+
+
+std::ostream& operator<<( std::ostream& r_stream, const ThreadPoolStatistics& r_statistics )
+{
+    const auto flags     = r_stream.flags();
+    const auto precision = r_stream.precision();
+
+    #ifndef CIE_ENABLE_THREAD_POOL_STATISTICS
+    r_stream << "(thread pool statistics are disabled, define CIE_ENABLE_THREAD_POOL_STATISTICS to collect them)\n";
+    #endif
+
+    r_stream << "thread pool utilization: "
+             << std::fixed << std::setprecision(1) << 100.0 * r_statistics.utilization() << "%\n"
+             << std::setw(10) << "thread"
+             << std::setw(10) << "jobs"
+             << std::setw(10) << "stolen"
+             << std::setw(12) << "busy [s]"
+             << std::setw(12) << "idle [s]"
+             << std::setw(12) << "lock [s]"
+             << std::setw(10) << "queue max" << '\n';
+
+    for ( Size i=0; i<r_statistics.workers.size(); ++i )
+        r_stream << std::setw(10) << i << r_statistics.workers[i] << '\n';
+
+    r_stream << std::setw(10) << "external" << r_statistics.external << '\n'
+             << std::setw(10) << "total"    << r_statistics.total();
+
+    r_stream.flags( flags );
+    r_stream.precision( precision );
+    return r_stream;
+}
+
+
+namespace detail {
+
+
+Size WorkerCounters::elapsed( WorkerCounters::clock_type::time_point begin )
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>( WorkerCounters::clock_type::now() - begin ).count();
+}
+
+
+void WorkerCounters::updateHighWaterMark( Size queueSize )
+{
+    Size current = this->queueHighWaterMark.load( std::memory_order_relaxed );
+    while ( current < queueSize
+            && !this->queueHighWaterMark.compare_exchange_weak(current, queueSize, std::memory_order_relaxed) )
+    {}
+}
+
+
+WorkerStatistics WorkerCounters::snapshot() const
+{
+    WorkerStatistics statistics;
+
+    statistics.numberOfJobs       = this->numberOfJobs.load( std::memory_order_relaxed );
+    statistics.numberOfStolenJobs = this->numberOfStolenJobs.load( std::memory_order_relaxed );
+    statistics.busyTime           = 1e-9 * this->busyTime.load( std::memory_order_relaxed );
+    statistics.idleTime           = 1e-9 * this->idleTime.load( std::memory_order_relaxed );
+    statistics.lockWaitTime       = 1e-9 * this->lockWaitTime.load( std::memory_order_relaxed );
+    statistics.queueHighWaterMark = this->queueHighWaterMark.load( std::memory_order_relaxed );
+
+    return statistics;
+}
+
+
+void WorkerCounters::reset()
+{
+    this->numberOfJobs.store( 0, std::memory_order_relaxed );
+    this->numberOfStolenJobs.store( 0, std::memory_order_relaxed );
+    this->busyTime.store( 0, std::memory_order_relaxed );
+    this->idleTime.store( 0, std::memory_order_relaxed );
+    this->lockWaitTime.store( 0, std::memory_order_relaxed );
+    this->queueHighWaterMark.store( 0, std::memory_order_relaxed );
+}
+
+
+} // namespace detail
+
+
+} // namespace cie::mp
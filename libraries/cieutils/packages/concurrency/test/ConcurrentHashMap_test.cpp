@@ -0,0 +1,111 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/concurrency/inc/ConcurrentHashMap.hpp"
+#include "cieutils/packages/concurrency/inc/ParallelFor.hpp"
+#include "cieutils/packages/stl_extension/inc/hash.hpp"
+
+// --- STL Includes ---
+#include <array>
+#include <vector>
+#include <atomic>
+#include <utility>
+
+
+namespace cie::mp {
+
+
+CIE_TEST_CASE( "ConcurrentHashMap", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ConcurrentHashMap" )
+
+    using MapType = ConcurrentHashMap<int,int>;
+
+    {
+        CIE_TEST_CASE_INIT( "serial" )
+
+        MapType map( 5 );
+        CIE_TEST_CHECK( map.numberOfShards() == 8 );
+        CIE_TEST_CHECK( map.empty() );
+
+        CIE_TEST_CHECK( map.emplace(1, 10) );
+        CIE_TEST_CHECK( !map.emplace(1, 20) );
+        CIE_TEST_CHECK( map.insert({2, 20}) );
+        CIE_TEST_CHECK( map.size() == 2 );
+
+        CIE_TEST_REQUIRE( map.find(1).has_value() );
+        CIE_TEST_CHECK( map.find(1).value() == 10 );
+        CIE_TEST_CHECK( !map.find(3).has_value() );
+        CIE_TEST_CHECK( map.contains(2) );
+        CIE_TEST_CHECK( !map.contains(3) );
+
+        map.insertOrAssign( 1, 11 );
+        CIE_TEST_CHECK( map.find(1).value() == 11 );
+
+        CIE_TEST_CHECK( map.getOrInsert(1, []() { return 0; }) == 11 );
+        CIE_TEST_CHECK( map.getOrInsert(3, []() { return 30; }) == 30 );
+        CIE_TEST_CHECK( map.size() == 3 );
+
+        CIE_TEST_CHECK( map.erase(3) );
+        CIE_TEST_CHECK( !map.erase(3) );
+
+        map.insert( {3, 30} );
+        CIE_TEST_CHECK( !map.eraseIf(3, []( int value ) { return value == 31; }) );
+        CIE_TEST_CHECK( map.contains(3) );
+        CIE_TEST_CHECK( map.eraseIf(3, []( int value ) { return value == 30; }) );
+        CIE_TEST_CHECK( !map.contains(3) );
+        CIE_TEST_CHECK( !map.eraseIf(3, []( int ) { return true; }) );
+
+        int sum = 0;
+        map.forEach( [&sum]( int key, int value ) { sum += key + value; } );
+        CIE_TEST_CHECK( sum == 1 + 11 + 2 + 20 );
+
+        map.clear();
+        CIE_TEST_CHECK( map.empty() );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "bulk insert" )
+
+        MapType map;
+        std::vector<std::pair<int,int>> items;
+        for ( int i=0; i<1000; ++i )
+            items.emplace_back( i % 500, i );
+
+        // Duplicate keys: the first occurrence wins
+        CIE_TEST_CHECK( map.insert(items.begin(), items.end()) == 500 );
+        CIE_TEST_CHECK( map.size() == 500 );
+        CIE_TEST_CHECK( map.find(10).value() == 10 );
+        CIE_TEST_CHECK( map.insert(items.begin(), items.end()) == 0 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "parallel" )
+
+        const Size numberOfKeys = 1000;
+        ConcurrentHashMap<std::array<double,2>,Size,utils::ContainerHash> map;
+        std::atomic<Size> numberOfGenerations = 0;
+
+        ParallelFor<Size>().setSchedule( LoopSchedule::Dynamic, 16 )(
+            4 * numberOfKeys,
+            [&]( Size index ) -> void
+            {
+                Size key = index % numberOfKeys;
+                Size value = map.getOrInsert(
+                    {double(key), 0.5},
+                    [key, &numberOfGenerations]() { ++numberOfGenerations; return key; }
+                );
+                CIE_TEST_CHECK( value == key );
+            }
+        );
+
+        CIE_TEST_CHECK( map.size() == numberOfKeys );
+        CIE_TEST_CHECK( numberOfKeys <= numberOfGenerations );
+
+        Size sum = 0;
+        map.forEach( [&sum]( const auto&, Size value ) { sum += value; } );
+        CIE_TEST_CHECK( sum == numberOfKeys * (numberOfKeys - 1) / 2 );
+    }
+}
+
+
+} // namespace cie::mp
@@ -5,6 +5,9 @@
 // --- STL Includes ---
 #include <vector>
 #include <string>
+#include <atomic>
+#include <stdexcept>
+#include <algorithm>
 
 
 namespace cie::mp {
@@ -62,4 +65,140 @@ CIE_TEST_CASE( "ParallelFor", "[concurrency]" )
 }
 
 
+CIE_TEST_CASE( "ParallelFor schedules", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ParallelFor schedules" )
+
+    const int indexMin = 3;
+    const int indexMax = 1003;
+
+    for ( auto schedule : { LoopSchedule::Static, LoopSchedule::Dynamic, LoopSchedule::Guided } )
+    {
+        for ( int chunkSize : { 0, 1, 7, 2000 } )
+        {
+            for ( int stepSize : { 1, 3, -1, -3 } )
+            {
+                std::vector<std::atomic<int>> counters( indexMax + 1 );
+                for ( auto& r_counter : counters )
+                    r_counter = 0;
+
+                int begin = stepSize < 0 ? indexMax : indexMin;
+                int end   = stepSize < 0 ? indexMin : indexMax;
+
+                ParallelFor<int>().setSchedule( schedule, chunkSize )(
+                    begin,
+                    end,
+                    stepSize,
+                    [&counters]( int index ) -> void { ++counters[index]; }
+                );
+
+                // Every index in the range must be visited exactly once
+                bool success = true;
+                for ( int index=0; index<int(counters.size()); ++index )
+                {
+                    int expected = 0;
+                    if ( 0 < stepSize && begin <= index && index < end && (index - begin) % stepSize == 0 )
+                        expected = 1;
+                    else if ( stepSize < 0 && end < index && index <= begin && (begin - index) % (-stepSize) == 0 )
+                        expected = 1;
+
+                    success = success && (counters[index] == expected);
+                }
+
+                CIE_TEST_CHECK( success );
+            }
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "first private" )
+
+        auto loop = ParallelFor<Size>::firstPrivate( Size(0) );
+        loop.setSchedule( LoopSchedule::Dynamic ).setChunkSize( 16 );
+
+        CIE_TEST_CHECK( loop.schedule() == LoopSchedule::Dynamic );
+        CIE_TEST_CHECK( loop.chunkSize() == 16 );
+
+        std::atomic<Size> sum = 0;
+        ParallelFor<Size>::firstPrivate( Size(0) ).setSchedule( LoopSchedule::Guided, 4 )(
+            100,
+            [&sum]( Size index, Size& r_private ) -> void
+            {
+                r_private += index;
+                sum += index;
+            }
+        );
+
+        CIE_TEST_CHECK( sum == 4950 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "exceptions" )
+
+        CIE_TEST_CHECK_THROWS( ParallelFor<>().setSchedule( LoopSchedule::Dynamic )(
+            100,
+            []( Size index ) -> void
+            {
+                if ( index == 50 )
+                    throw std::runtime_error( "test" );
+            }
+        ) );
+    }
+}
+
+
+CIE_TEST_CASE( "ParallelFor reduce", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ParallelFor reduce" )
+
+    const auto sum = []( Size lhs, Size rhs ) -> Size { return lhs + rhs; };
+
+    for ( auto schedule : {LoopSchedule::Static, LoopSchedule::Dynamic, LoopSchedule::Guided} )
+    {
+        CIE_TEST_CHECK( ParallelFor<Size>().setSchedule( schedule, 3 ).reduce(
+            1001,
+            Size(0),
+            sum,
+            []( Size index, Size& r_sum ) -> void { r_sum += index; }
+        ) == 500500 );
+
+        // Reverse loop
+        CIE_TEST_CHECK( ParallelFor<int>().setSchedule( schedule ).reduce(
+            10,
+            0,
+            -2,
+            0,
+            []( int lhs, int rhs ) -> int { return lhs + rhs; },
+            []( int index, int& r_sum ) -> void { r_sum += index; }
+        ) == 30 );
+
+        // Empty range
+        CIE_TEST_CHECK( ParallelFor<Size>().setSchedule( schedule ).reduce(
+            0,
+            Size(0),
+            sum,
+            []( Size index, Size& r_sum ) -> void { r_sum += index; }
+        ) == 0 );
+    }
+
+    // Non-arithmetic reduction with first private storage
+    std::vector<Size> indices = ParallelFor<Size>::firstPrivate( Size(2) ).reduce(
+        100,
+        std::vector<Size>(),
+        []( std::vector<Size> lhs, const std::vector<Size>& r_rhs ) -> std::vector<Size>
+        {
+            lhs.insert( lhs.end(), r_rhs.begin(), r_rhs.end() );
+            return lhs;
+        },
+        []( Size index, std::vector<Size>& r_indices, Size& r_factor ) -> void
+        { r_indices.push_back( r_factor * index ); }
+    );
+
+    CIE_TEST_REQUIRE( indices.size() == 100 );
+    std::sort( indices.begin(), indices.end() );
+    for ( Size i=0; i<indices.size(); ++i )
+        CIE_TEST_CHECK( indices[i] == 2 * i );
+}
+
+
 } // namespace cie::mp
\ No newline at end of file
@@ -0,0 +1,52 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/concurrency/inc/PriorityJobQueue.hpp"
+
+// --- STL Includes ---
+#include <functional>
+#include <vector>
+
+
+namespace cie::mp {
+
+
+CIE_TEST_CASE( "PriorityJobQueue", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "PriorityJobQueue" )
+
+    using JobType = std::function<void()>;
+
+    PriorityJobQueue<JobType> queue;
+    std::vector<int> order;
+
+    CIE_TEST_CHECK( queue.empty() );
+    CIE_TEST_CHECK( queue.topPriority() == 0 );
+
+    JobType job;
+    CIE_TEST_CHECK( !queue.pop(job) );
+
+    // Priorities: 1, 3, 1, 2, 3
+    queue.push( [&order]() { order.push_back(0); }, 1 );
+    queue.push( [&order]() { order.push_back(1); }, 3 );
+    queue.push( [&order]() { order.push_back(2); }, 1 );
+    queue.push( [&order]() { order.push_back(3); }, 2 );
+    queue.push( [&order]() { order.push_back(4); }, 3 );
+
+    CIE_TEST_CHECK( queue.size() == 5 );
+    CIE_TEST_CHECK( queue.topPriority() == 3 );
+
+    while ( queue.pop(job) )
+        job();
+
+    // Higher priorities first, FIFO within equal priorities
+    CIE_TEST_REQUIRE( order.size() == 5 );
+    CIE_TEST_CHECK( order[0] == 1 );
+    CIE_TEST_CHECK( order[1] == 4 );
+    CIE_TEST_CHECK( order[2] == 3 );
+    CIE_TEST_CHECK( order[3] == 0 );
+    CIE_TEST_CHECK( order[4] == 2 );
+    CIE_TEST_CHECK( queue.empty() );
+}
+
+
+} // namespace cie::mp
@@ -0,0 +1,114 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/concurrency/inc/Task.hpp"
+
+// --- STL Includes ---
+#include <memory>
+#include <array>
+#include <vector>
+
+
+namespace cie::mp {
+
+
+CIE_TEST_CASE( "Task", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "Task" )
+
+    int counter = 0;
+
+    {
+        CIE_TEST_CASE_INIT( "empty" )
+
+        Task task;
+        CIE_TEST_CHECK( !task );
+        CIE_TEST_CHECK( !task.isInline() );
+
+        Task nullTask = nullptr;
+        CIE_TEST_CHECK( !nullTask );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "inline storage" )
+
+        Task task( [&counter]() { ++counter; } );
+        CIE_TEST_REQUIRE( bool(task) );
+        CIE_TEST_CHECK( task.isInline() );
+
+        task();
+        CIE_TEST_CHECK( counter == 1 );
+
+        // Move construction and assignment
+        Task moved( std::move(task) );
+        CIE_TEST_CHECK( !task );
+        CIE_TEST_REQUIRE( bool(moved) );
+        moved();
+        CIE_TEST_CHECK( counter == 2 );
+
+        task = std::move( moved );
+        CIE_TEST_CHECK( !moved );
+        task();
+        CIE_TEST_CHECK( counter == 3 );
+
+        task = nullptr;
+        CIE_TEST_CHECK( !task );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "heap storage" )
+
+        std::array<int,64> values;
+        values.fill( 1 );
+
+        Task task( [&counter, values]() { for ( int value : values ) counter += value; } );
+        CIE_TEST_CHECK( !task.isInline() );
+
+        Task moved( std::move(task) );
+        CIE_TEST_CHECK( !task );
+        moved();
+        CIE_TEST_CHECK( counter == 67 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "move-only and stateful callables" )
+
+        auto p_value = std::make_unique<int>( 0 );
+        Task task( [p_value = std::move(p_value)]() mutable { ++(*p_value); } );
+        CIE_TEST_CHECK( task.isInline() );
+
+        task();
+        task();
+
+        // Moving a task must not duplicate or leak the callable
+        std::vector<Task> tasks;
+        for ( int i=0; i<10; ++i )
+        {
+            tasks.emplace_back( std::move(task) );
+            task = std::move( tasks.back() );
+            tasks.back() = nullptr;
+        }
+        task();
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "destruction" )
+
+        auto p_shared = std::make_shared<int>( 0 );
+        std::array<int,64> padding {};
+
+        {
+            Task inlineTask( [p_shared]() {} );
+            Task heapTask( [p_shared, padding]() {} );
+            CIE_TEST_CHECK( p_shared.use_count() == 3 );
+
+            Task moved( std::move(heapTask) );
+            moved = std::move( inlineTask );
+            CIE_TEST_CHECK( p_shared.use_count() == 2 );
+        }
+
+        CIE_TEST_CHECK( p_shared.use_count() == 1 );
+    }
+}
+
+
+} // namespace cie::mp
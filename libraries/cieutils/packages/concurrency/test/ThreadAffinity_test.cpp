@@ -0,0 +1,57 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadAffinity.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+
+// --- STL Includes ---
+#include <atomic>
+#include <vector>
+
+
+namespace cie::mp {
+
+
+CIE_TEST_CASE( "ThreadAffinity", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ThreadAffinity" )
+
+    {
+        CIE_TEST_CASE_INIT( "parse core list" )
+
+        using Cores = ThreadAffinity::core_container;
+
+        CIE_TEST_CHECK( ThreadAffinity::parseCoreList( "" ) == Cores {} );
+        CIE_TEST_CHECK( ThreadAffinity::parseCoreList( "3" ) == Cores {3} );
+        CIE_TEST_CHECK( ThreadAffinity::parseCoreList( "0-3,8,10-11\n" ) == Cores {0,1,2,3,8,10,11} );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "topology" )
+
+        CIE_TEST_CHECK( ThreadAffinity().empty() );
+        CIE_TEST_CHECK( !ThreadAffinity::allCores().empty() );
+        CIE_TEST_CHECK( 0 < ThreadAffinity::numberOfNUMANodes() );
+        CIE_TEST_CHECK( !ThreadAffinity::numaNode(0).empty() );
+        CIE_TEST_CHECK_THROWS( ThreadAffinity::numaNode( ThreadAffinity::numberOfNUMANodes() ) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "pinned pool" )
+
+        ThreadAffinity affinity = ThreadAffinity::numaNode( 0 );
+        ThreadPool pool( ThreadPool::maxNumberOfThreads(), ThreadPool::Scheduling::WorkStealing, affinity );
+        CIE_TEST_CHECK( pool.affinity().cores() == affinity.cores() );
+
+        std::atomic<Size> counter = 0;
+        std::vector<JobHandle<void>> handles;
+
+        for ( Size i=0; i<100; ++i )
+            handles.push_back( pool.submit( [&counter]() { ++counter; } ) );
+
+        pool.waitFor( handles );
+        CIE_TEST_CHECK( counter == 100 );
+    }
+}
+
+
+} // namespace cie::mp
@@ -0,0 +1,41 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolSingleton.hpp"
+#include "cieutils/packages/concurrency/inc/ParallelFor.hpp"
+
+// --- STL Includes ---
+#include <atomic>
+
+
+namespace cie::mp {
+
+
+CIE_TEST_CASE( "ThreadPoolSingleton", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ThreadPoolSingleton" )
+
+    ThreadPool& r_pool = ThreadPoolSingleton::get();
+
+    CIE_TEST_CHECK( ThreadPoolSingleton::isStarted() );
+    CIE_TEST_CHECK( &r_pool == &ThreadPoolSingleton::get() );
+    CIE_TEST_CHECK( &r_pool == ThreadPoolSingleton::getPtr().get() );
+    CIE_TEST_CHECK( ThreadPoolSingleton::size() == r_pool.size() );
+
+    // The size cannot be changed once the pool is running
+    CIE_TEST_CHECK_THROWS( ThreadPoolSingleton::setSize( 1 ) );
+
+    // Nested loops on the default pool must not deadlock
+    std::atomic<Size> counter = 0;
+    ParallelFor<>()(
+        10,
+        [&counter]( Size ) -> void
+        {
+            ParallelFor<>()( 10, [&counter]( Size ) -> void { ++counter; } );
+        }
+    );
+
+    CIE_TEST_CHECK( counter == 100 );
+}
+
+
+} // namespace cie::mp
@@ -0,0 +1,70 @@
+// --- Utility Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/concepts/inc/streamable.hpp"
+
+// --- Internal Includes ---
+#include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPoolStatistics.hpp"
+
+// --- STL Includes ---
+#include <sstream>
+#include <atomic>
+
+
+namespace cie::mp {
+
+
+CIE_TEST_CASE( "ThreadPoolStatistics", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ThreadPoolStatistics" )
+
+    // Dumpable to utils::Logger
+    CIE_TEST_CHECK( concepts::StringStreamable<ThreadPoolStatistics> );
+
+    const Size numberOfJobs = 1000;
+
+    ThreadPool pool;
+    std::atomic<Size> counter = 0;
+
+    for ( Size i=0; i<numberOfJobs; ++i )
+        pool.queueJob( [&counter]() -> void { ++counter; } );
+
+    // Execute a job from outside the pool
+    auto handle = pool.submit( [](){ return 1; } );
+    pool.waitFor( handle );
+    pool.barrier();
+
+    CIE_TEST_CHECK( counter == numberOfJobs );
+
+    auto statistics = pool.statistics();
+    CIE_TEST_CHECK( statistics.workers.size() == pool.size() );
+
+    #ifdef CIE_ENABLE_THREAD_POOL_STATISTICS
+    CIE_TEST_CHECK( statistics.total().numberOfJobs == numberOfJobs + 1 );
+    CIE_TEST_CHECK( 0 < statistics.total().busyTime );
+    CIE_TEST_CHECK( 0 < statistics.total().queueHighWaterMark );
+    CIE_TEST_CHECK( statistics.total().queueHighWaterMark <= numberOfJobs + 1 );
+    CIE_TEST_CHECK( statistics.total().numberOfStolenJobs <= statistics.total().numberOfJobs );
+    CIE_TEST_CHECK( 0 <= statistics.utilization() );
+    CIE_TEST_CHECK( statistics.utilization() <= 1 );
+    #else
+    CIE_TEST_CHECK( statistics.total().numberOfJobs == 0 );
+    CIE_TEST_CHECK( statistics.total().busyTime == 0 );
+    #endif
+
+    std::stringstream stream;
+    CIE_TEST_CHECK_NOTHROW( stream << statistics );
+    CIE_TEST_CHECK( stream.str().find("total") != std::string::npos );
+
+    pool.resetStatistics();
+    statistics = pool.statistics();
+    CIE_TEST_CHECK( statistics.total().numberOfJobs == 0 );
+    CIE_TEST_CHECK( statistics.total().queueHighWaterMark == 0 );
+
+    // Counters stay accessible after the threads are joined
+    pool.terminate();
+    CIE_TEST_CHECK( pool.statistics().workers.size() == statistics.workers.size() );
+}
+
+
+} // namespace cie::mp
@@ -9,6 +9,10 @@
 #include <thread>
 #include <chrono>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <mutex>
 
 
 namespace cie::mp {
@@ -39,4 +43,209 @@ CIE_TEST_CASE( "ThreadPool", "[concurrency]" )
 }
 
 
+CIE_TEST_CASE( "ThreadPool scheduling", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ThreadPool scheduling" )
+
+    const Size numberOfJobs = 100;
+    const Size depth        = 3;
+
+    for ( auto scheduling : { ThreadPool::Scheduling::Shared, ThreadPool::Scheduling::WorkStealing } )
+    {
+        ThreadPool pool( ThreadPool::maxNumberOfThreads(), scheduling );
+        CIE_TEST_CHECK( pool.scheduling() == scheduling );
+
+        std::atomic<Size> counter = 0;
+
+        // Jobs that queue further jobs from within the pool
+        std::function<void(Size)> recursiveJob = [&pool, &counter, &recursiveJob]( Size level ) -> void
+        {
+            ++counter;
+            if ( level )
+                for ( Size i=0; i<2; ++i )
+                    pool.queueJob( std::bind(recursiveJob, level - 1) );
+        };
+
+        for ( Size i=0; i<numberOfJobs; ++i )
+            pool.queueJob( std::bind(recursiveJob, depth) );
+
+        pool.barrier();
+        CIE_TEST_CHECK( pool.numberOfJobs() == 0 );
+        CIE_TEST_CHECK( counter == numberOfJobs * ((1 << (depth + 1)) - 1) );
+
+        // Reuse the pool after the barrier
+        for ( Size i=0; i<numberOfJobs; ++i )
+            pool.queueJob( [&counter]() -> void { ++counter; } );
+
+        pool.barrier();
+        CIE_TEST_CHECK( counter == numberOfJobs * (1 << (depth + 1)) );
+    }
+}
+
+
+namespace threadpool {
+
+Size fibonacci( ThreadPool& r_pool, Size index )
+{
+    if ( index < 2 )
+        return index;
+
+    // Split the work and join the branches without waiting for unrelated jobs
+    auto lhs = r_pool.submit( &fibonacci, std::ref(r_pool), index - 1 );
+    auto rhs = r_pool.submit( &fibonacci, std::ref(r_pool), index - 2 );
+    r_pool.waitFor( lhs, rhs );
+
+    return lhs.get() + rhs.get();
+}
+
+
+/// Number of nested jobs on the calling thread
+thread_local Size nestingLevel = 0;
+
+/// Count the jobs of a tree, recording the deepest nesting of jobs
+Size countJobs( ThreadPool& r_pool, Size level, std::atomic<Size>& r_maxNestingLevel )
+{
+    ++nestingLevel;
+
+    Size current = r_maxNestingLevel;
+    while ( current < nestingLevel && !r_maxNestingLevel.compare_exchange_weak(current, nestingLevel) ) {}
+
+    Size count = 1;
+    if ( level )
+    {
+        std::vector<JobHandle<Size>> handles;
+        for ( Size i=0; i<4; ++i )
+            handles.push_back( r_pool.submit( &countJobs, std::ref(r_pool), level - 1, std::ref(r_maxNestingLevel) ) );
+
+        r_pool.waitFor( handles );
+        for ( const auto& r_handle : handles )
+            count += r_handle.get();
+    }
+
+    --nestingLevel;
+    return count;
+}
+
+} // namespace threadpool
+
+
+CIE_TEST_CASE( "ThreadPool submit", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ThreadPool submit" )
+
+    for ( auto scheduling : { ThreadPool::Scheduling::Shared, ThreadPool::Scheduling::WorkStealing } )
+    {
+        ThreadPool pool( ThreadPool::maxNumberOfThreads(), scheduling );
+
+        {
+            CIE_TEST_CASE_INIT( "results" )
+
+            auto handle = pool.submit( []( int lhs, int rhs ) { return lhs + rhs; }, 1, 2 );
+            CIE_TEST_CHECK( handle.get() == 3 );
+            CIE_TEST_CHECK( handle.done() );
+
+            std::atomic<Size> counter = 0;
+            auto voidHandle = pool.submit( [&counter]() { ++counter; } );
+            voidHandle.wait();
+            CIE_TEST_CHECK( counter == 1 );
+
+            std::vector<JobHandle<Size>> handles;
+            for ( Size i=0; i<100; ++i )
+                handles.push_back( pool.submit( []( Size value ) { return value * value; }, i ) );
+
+            pool.waitFor( handles );
+            for ( Size i=0; i<handles.size(); ++i )
+            {
+                CIE_TEST_CHECK( handles[i].done() );
+                CIE_TEST_CHECK( handles[i].get() == i * i );
+            }
+        }
+
+        {
+            CIE_TEST_CASE_INIT( "nested" )
+
+            // Waiting from within jobs must not deadlock, even on a single thread
+            auto handle = pool.submit( &threadpool::fibonacci, std::ref(pool), 12 );
+            CIE_TEST_CHECK( handle.get() == 144 );
+
+            // Waiting threads help with the subtree they wait for, instead of
+            // starting unrelated jobs that might wait themselves
+            const Size depth = 6;
+            std::atomic<Size> maxNestingLevel = 0;
+            CIE_TEST_CHECK( threadpool::countJobs( pool, depth, maxNestingLevel ) == ((1 << (2*depth + 2)) - 1) / 3 );
+            CIE_TEST_CHECK( maxNestingLevel <= 2 * (depth + 1) );
+        }
+
+        {
+            CIE_TEST_CASE_INIT( "exceptions" )
+
+            auto handle = pool.submit( []() -> int { throw std::runtime_error("test"); } );
+            CIE_TEST_CHECK_THROWS( handle.get() );
+        }
+
+        pool.barrier();
+    }
+}
+
+
+CIE_TEST_CASE( "ThreadPool priorities and cancellation", "[concurrency]" )
+{
+    CIE_TEST_CASE_INIT( "ThreadPool priorities and cancellation" )
+
+    for ( auto scheduling : { ThreadPool::Scheduling::Shared, ThreadPool::Scheduling::WorkStealing } )
+    {
+        // Single thread for a deterministic execution order
+        ThreadPool pool( 1, scheduling );
+
+        std::atomic<bool> started = false;
+        std::atomic<bool> release = false;
+        std::mutex mutex;
+        std::vector<int> order;
+        auto record = [&order, &mutex]( int value ) -> void
+        {
+            std::scoped_lock<std::mutex> lock( mutex );
+            order.push_back( value );
+        };
+
+        // Keep the thread busy until every job is queued
+        // (wait until it runs, so it doesn't compete with the other jobs)
+        pool.queueJob( [&started, &release]() -> void
+        {
+            started = true;
+            while ( !release )
+                std::this_thread::yield();
+        } );
+
+        while ( !started )
+            std::this_thread::yield();
+
+        CancellationToken token;
+        CancellationToken otherToken;
+
+        pool.queueJob( std::bind(record, 0) );
+        pool.queueJob( std::bind(record, 1), token );
+        pool.queueJob( std::bind(record, 2), token, 5 );
+        pool.queueJob( std::bind(record, 3), otherToken, 1 );
+        pool.queueJob( std::bind(record, 4), 2 );
+        pool.queueJob( std::bind(record, 5), 2 );
+
+        CIE_TEST_CHECK( !token.isCancelled() );
+        token.cancel();
+        CIE_TEST_CHECK( token.isCancelled() );
+        CIE_TEST_CHECK( !otherToken.isCancelled() );
+
+        release = true;
+        pool.barrier();
+
+        // Cancelled jobs are dropped, prioritized jobs jump ahead
+        CIE_TEST_REQUIRE( order.size() == 4 );
+        CIE_TEST_CHECK( order[0] == 4 );
+        CIE_TEST_CHECK( order[1] == 5 );
+        CIE_TEST_CHECK( order[2] == 3 );
+        CIE_TEST_CHECK( order[3] == 0 );
+        CIE_TEST_CHECK( pool.numberOfJobs() == 0 );
+    }
+}
+
+
 } // namespace cie::mp
\ No newline at end of file
@@ -41,8 +41,11 @@ public:
 
     Size stackLevel() const;
 
+    /// Wrap the message in the context of the calling function
+    void addStackLevel( const String& r_location );
+
 private:
-    const Size      _stackLevel;
+    Size            _stackLevel;
     String          _what;
 };
 
@@ -96,6 +99,19 @@ struct MemoryException : public Exception
 };
 
 
+namespace detail {
+
+/**
+ * Rethrow the exception currently being handled, traced at the specified location.
+ * CIE exceptions are extended in place (their type is preserved), other exceptions
+ * are converted to cie::Exception.
+ * @note must be called from a catch block
+ */
+[[noreturn]] void rethrowTraced( const char* p_location );
+
+} // namespace detail
+
+
 } // namespace cie
 
 
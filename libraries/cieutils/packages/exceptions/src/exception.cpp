@@ -53,6 +53,16 @@ Size Exception::stackLevel() const
 }
 
 
+void Exception::addStackLevel( const String& r_location )
+{
+    ++_stackLevel;
+    _what =
+        "(Exception stack " + std::to_string(_stackLevel) + ")\n"
+        + r_location + "\n"
+        + _what + "\n";
+}
+
+
 
 NullPtrException::NullPtrException( const String& r_location,
                                     const String& r_message ) :
@@ -103,4 +113,31 @@ MemoryException::MemoryException( const String& r_location,
 }
 
 
+namespace detail {
+
+void rethrowTraced( const char* p_location )
+{
+    try
+    {
+        throw;
+    }
+    catch ( Exception& r_exception )
+    {
+        // Modify the exception in flight instead of throwing a new one
+        r_exception.addStackLevel( p_location );
+        throw;
+    }
+    catch ( const std::exception& r_exception )
+    {
+        throw Exception( p_location, String("std::exception: ") + r_exception.what() );
+    }
+    catch ( ... )
+    {
+        throw Exception( p_location, "Unknown exception" );
+    }
+}
+
+} // namespace detail
+
+
 } // namespace cie
\ No newline at end of file
@@ -12,6 +12,8 @@
 #include <istream>
 #include <ostream>
 #include <filesystem>
+#include <vector>
+#include <cstdint>
 
 
 namespace cie::io {
@@ -55,12 +57,27 @@ namespace cie::io
  *
  *      std::vector of any above except bool
  *      std::array of any above with size 1, 2, or 3
+ *
+ *  @details besides text, the contents can be read from and written to binary
+ *           formats (CBOR, MessagePack, UBJSON) that load considerably faster.
+ *           Files are read in whichever of these formats they are stored in.
  */
 class JSONObject
 {
 public:
     using content_type = nlohmann::json;
 
+    using binary_type = std::vector<std::uint8_t>;
+
+    /// Supported serialization formats
+    enum class Format
+    {
+        Text,
+        CBOR,
+        MessagePack,
+        UBJSON
+    };
+
 public:
     JSONObject();
 
@@ -74,8 +91,17 @@ public:
 
     JSONObject( std::string&& r_jsonString );
 
+    /// Load a file in any of the supported formats (detected from its contents)
     JSONObject( const std::filesystem::path& r_filePath );
 
+    /// Load a file in the specified format
+    JSONObject( const std::filesystem::path& r_filePath,
+                Format format );
+
+    /// Parse a buffer in the specified format
+    JSONObject( const binary_type& r_buffer,
+                Format format );
+
     JSONObject( std::istream& r_stream );
 
     /// Constructor for operator[]
@@ -148,6 +174,16 @@ public:
     /// Get the root that holds the resources
     const JSONObject& root() const;
 
+    /// Serialize the contents in the specified format
+    binary_type serialize( Format format ) const;
+
+    /// Write the contents to a file in the specified format
+    void write( const std::filesystem::path& r_filePath,
+                Format format = Format::Text ) const;
+
+    /// Identify the format of a serialized buffer (throws if none of the supported formats match)
+    static Format detectFormat( const binary_type& r_buffer );
+
 private:
     /// Set / get helper class
     template <class ValueType>
@@ -12,11 +12,125 @@
 #include <vector>
 #include <array>
 #include <iostream>
+#include <algorithm>
+#include <cctype>
 
 
 namespace cie::io {
 
 
+// ----------------------------------------------------------
+// SERIALIZATION HELPERS
+// ----------------------------------------------------------
+
+namespace {
+
+/// Self-described CBOR tag (RFC 8949 3.4.6) prepended to CBOR output to make it identifiable
+const JSONObject::binary_type cborMagic = { 0xd9, 0xd9, 0xf7 };
+
+
+JSONObject::binary_type readFile( const std::filesystem::path& r_filePath )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::ifstream file( r_filePath, std::ios::binary | std::ios::ate );
+    if ( !file )
+        CIE_THROW( Exception, "Failed to open " + r_filePath.string() )
+
+    JSONObject::binary_type buffer( file.tellg() );
+    file.seekg( 0 );
+    file.read( reinterpret_cast<char*>(buffer.data()), buffer.size() );
+
+    return buffer;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+/// Parse a buffer in the specified format (returns a discarded value on failure if exceptions are not allowed)
+nlohmann::json parse( const JSONObject::binary_type& r_buffer,
+                      JSONObject::Format format,
+                      bool allowExceptions = true )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    switch ( format )
+    {
+        case JSONObject::Format::Text:
+            return nlohmann::json::parse( r_buffer.begin(), r_buffer.end(), nullptr, allowExceptions );
+        case JSONObject::Format::CBOR:
+            return nlohmann::json::from_cbor( r_buffer, true, allowExceptions, nlohmann::json::cbor_tag_handler_t::ignore );
+        case JSONObject::Format::MessagePack:
+            return nlohmann::json::from_msgpack( r_buffer, true, allowExceptions );
+        case JSONObject::Format::UBJSON:
+            return nlohmann::json::from_ubjson( r_buffer, true, allowExceptions );
+    }
+
+    CIE_THROW( Exception, "Unknown format" )
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+/// Check whether a buffer begins like text json
+bool isTextLike( const JSONObject::binary_type& r_buffer )
+{
+    if ( r_buffer.empty() )
+        return true;
+
+    const unsigned char c = r_buffer.front();
+    return std::isspace( c ) || std::isdigit( c )
+           || c == '{' || c == '[' || c == '"' || c == '-'
+           || c == 't' || c == 'f' || c == 'n';
+}
+
+
+/** Parse a buffer in the first matching format
+ *  @details the binary formats carry no signature (except for self-described CBOR),
+ *           so the candidates are parsed strictly (the whole buffer must be consumed)
+ *           in the order of likelihood, determined by the first byte.
+ */
+nlohmann::json detectAndParse( const JSONObject::binary_type& r_buffer,
+                               JSONObject::Format& r_format )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    using Format = JSONObject::Format;
+
+    const bool textLike = isTextLike( r_buffer );
+
+    std::vector<Format> candidates;
+    if ( cborMagic.size() <= r_buffer.size() && std::equal(cborMagic.begin(), cborMagic.end(), r_buffer.begin()) )
+        candidates = { Format::CBOR };
+    else if ( textLike )
+        candidates = { Format::Text, Format::UBJSON, Format::CBOR, Format::MessagePack };
+    else
+        // CBOR written by JSONObject is self-described, so untagged input is more likely
+        // MessagePack (eg: 0x80 is an empty MessagePack map but an empty CBOR array)
+        candidates = { Format::MessagePack, Format::CBOR, Format::UBJSON };
+
+    for ( auto format : candidates )
+    {
+        auto contents = parse( r_buffer, format, false );
+        if ( !contents.is_discarded() )
+        {
+            r_format = format;
+            return contents;
+        }
+    }
+
+    // Report the syntax error if this was meant to be text
+    if ( textLike )
+        parse( r_buffer, Format::Text );
+
+    CIE_THROW( Exception, "Input is not in any of the supported formats" )
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+} // namespace
+
+
 // ----------------------------------------------------------
 // MEMBER TEMPLATE HELPERS
 // ----------------------------------------------------------
@@ -601,8 +715,27 @@ JSONObject::JSONObject( const std::filesystem::path& r_filePath )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    std::ifstream file( r_filePath );
-    file >> *_p_contents;
+    Format format;
+    *_p_contents = detectAndParse( readFile(r_filePath), format );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+JSONObject::JSONObject( const std::filesystem::path& r_filePath,
+                        JSONObject::Format format )
+    : JSONObject( readFile(r_filePath), format )
+{
+}
+
+
+JSONObject::JSONObject( const JSONObject::binary_type& r_buffer,
+                        JSONObject::Format format )
+    : JSONObject()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    *_p_contents = parse( r_buffer, format );
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -781,6 +914,66 @@ const JSONObject& JSONObject::root() const
 }
 
 
+JSONObject::binary_type JSONObject::serialize( JSONObject::Format format ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    binary_type buffer;
+
+    switch ( format )
+    {
+        case Format::Text:
+        {
+            const std::string text = _p_contents->dump();
+            buffer.assign( text.begin(), text.end() );
+            break;
+        }
+        case Format::CBOR:
+            buffer = cborMagic;
+            nlohmann::json::to_cbor( *_p_contents, buffer );
+            break;
+        case Format::MessagePack:
+            nlohmann::json::to_msgpack( *_p_contents, buffer );
+            break;
+        case Format::UBJSON:
+            nlohmann::json::to_ubjson( *_p_contents, buffer );
+            break;
+    }
+
+    return buffer;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void JSONObject::write( const std::filesystem::path& r_filePath,
+                        JSONObject::Format format ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::ofstream file( r_filePath, std::ios::binary );
+    if ( !file )
+        CIE_THROW( Exception, "Failed to open " + r_filePath.string() )
+
+    const auto buffer = this->serialize( format );
+    file.write( reinterpret_cast<const char*>(buffer.data()), buffer.size() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+JSONObject::Format JSONObject::detectFormat( const JSONObject::binary_type& r_buffer )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Format format;
+    detectAndParse( r_buffer, format );
+    return format;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
 // ----------------------------------------------------------
 // NON-MEMBERS
 // ----------------------------------------------------------
@@ -230,4 +230,95 @@ CIE_TEST_CASE( "JSONObject", "[io]" )
 }
 
 
+CIE_TEST_CASE( "JSONObject - binary formats", "[io]" )
+{
+    CIE_TEST_CASE_INIT( "JSONObject - binary formats" )
+
+    using Format = JSONObject::Format;
+
+    const auto equals = []( const JSONObject& r_lhs, const JSONObject& r_rhs ) -> bool
+    { return r_lhs.serialize(Format::Text) == r_rhs.serialize(Format::Text); };
+
+    const JSONObject reference( std::string(R"({
+        "bool"        : true,
+        "string"      : "std::string",
+        "int"         : 12,
+        "float"       : 0.25,
+        "intArray"    : [1, 0],
+        "stringArray" : ["one", "zero"],
+        "mixedArray"  : [0.1, "tenth"],
+        "object" : {
+            "name"  : "mya-nee",
+            "power" : 9001
+        }
+    })") );
+
+    const std::vector<std::pair<Format,std::string>> formats = {
+        { Format::Text,         "json" },
+        { Format::CBOR,         "cbor" },
+        { Format::MessagePack,  "msgpack" },
+        { Format::UBJSON,       "ubjson" }
+    };
+
+    for ( const auto& [format, extension] : formats )
+    {
+        CIE_TEST_CASE_INIT( extension )
+
+        // Buffers
+        JSONObject::binary_type buffer;
+        CIE_TEST_REQUIRE_NOTHROW( buffer = reference.serialize(format) );
+        CIE_TEST_CHECK( JSONObject::detectFormat(buffer) == format );
+
+        JSONObject local;
+        CIE_TEST_REQUIRE_NOTHROW( local = JSONObject(buffer, format) );
+        CIE_TEST_CHECK( equals(local, reference) );
+        checkJSONObject<7>( local );
+
+        // Files
+        const std::filesystem::path filePath = TEST_OUTPUT_PATH / ( "JSONObject_test." + extension );
+        CIE_TEST_REQUIRE_NOTHROW( reference.write(filePath, format) );
+
+        CIE_TEST_REQUIRE_NOTHROW( local = JSONObject(filePath) );
+        CIE_TEST_CHECK( equals(local, reference) );
+        checkJSONObject<8>( local );
+
+        CIE_TEST_REQUIRE_NOTHROW( local = JSONObject(filePath, format) );
+        CIE_TEST_CHECK( equals(local, reference) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "CBOR without self-description" )
+
+        auto buffer = reference.serialize( Format::CBOR );
+        buffer.erase( buffer.begin(), buffer.begin() + 3 );
+
+        CIE_TEST_CHECK( JSONObject::detectFormat(buffer) == Format::CBOR );
+        CIE_TEST_CHECK( equals(JSONObject(buffer, Format::CBOR), reference) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "ambiguous input" )
+
+        // An empty MessagePack map is a valid (untagged) CBOR array too
+        const JSONObject empty( std::string("{}") );
+        const std::filesystem::path filePath = TEST_OUTPUT_PATH / "JSONObject_test_empty.msgpack";
+        CIE_TEST_REQUIRE_NOTHROW( empty.write(filePath, Format::MessagePack) );
+
+        JSONObject local;
+        CIE_TEST_REQUIRE_NOTHROW( local = JSONObject(filePath) );
+        CIE_TEST_CHECK( equals(local, empty) );
+        std::filesystem::remove( filePath );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "invalid input" )
+
+        const std::string invalidText = R"({"key" : })";
+        CIE_TEST_CHECK_THROWS( JSONObject::detectFormat(JSONObject::binary_type(invalidText.begin(), invalidText.end())) );
+        CIE_TEST_CHECK_THROWS( JSONObject::detectFormat(JSONObject::binary_type { 0xc1 }) );
+        CIE_TEST_CHECK_THROWS( JSONObject(TEST_OUTPUT_PATH / "nonExistentFile.json") );
+    }
+}
+
+
 } // namespace cie::io
\ No newline at end of file
@@ -0,0 +1,103 @@
+#ifndef CIE_UTILS_LOGGING_ASYNC_LOG_WRITER_HPP
+#define CIE_UTILS_LOGGING_ASYNC_LOG_WRITER_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <string>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace cie::utils::detail {
+
+
+/**
+ * @brief Bounded lock-free queue of log messages (multiple producers, single consumer).
+ * Every slot carries a sequence number that tells producers and the consumer
+ * whether it is free or filled, so neither side ever takes a lock.
+ */
+class LogRingBuffer
+{
+public:
+    /// Create a buffer with at least 'capacity' slots (rounded up to a power of 2)
+    LogRingBuffer( Size capacity );
+
+    /// @return false if the buffer is full
+    bool tryPush( std::string&& r_message );
+
+    /// @return false if the buffer is empty
+    bool tryPop( std::string& r_message );
+
+    Size capacity() const;
+
+private:
+    struct alignas(64) Slot
+    {
+        std::atomic<Size> sequence;
+        std::string       message;
+    };
+
+private:
+    std::unique_ptr<Slot[]>     _slots;
+    Size                        _mask;
+    alignas(64) std::atomic<Size> _pushIndex;
+    alignas(64) std::atomic<Size> _popIndex;
+};
+
+
+/**
+ * @brief Writes log messages on a background thread.
+ * Producers only format and enqueue messages, the writer thread collects
+ * all queued messages into a single batch and passes it to the write function.
+ * @note the write function is only called from the writer thread.
+ */
+class AsyncLogWriter
+{
+public:
+    using write_function = std::function<void(const std::string&)>;
+
+public:
+    AsyncLogWriter( write_function writeFunction,
+                    Size bufferSize = 4096 );
+
+    /// Write all queued messages and join the writer thread
+    ~AsyncLogWriter();
+
+    /// Queue a message (waits if the buffer is full)
+    void push( std::string&& r_message );
+
+    /// Block until every message queued so far has been written
+    void drain();
+
+private:
+    void run();
+
+    void wakeWriter();
+
+private:
+    LogRingBuffer           _buffer;
+    write_function          _write;
+
+    std::atomic<Size>       _numberOfPushedMessages;
+    std::atomic<Size>       _numberOfWrittenMessages;
+    std::atomic<bool>       _sleeping;
+    std::atomic<bool>       _terminate;
+
+    std::mutex              _mutex;
+    std::condition_variable _writerCondition;
+    std::condition_variable _drainCondition;
+
+    std::thread             _thread;
+};
+
+
+} // namespace cie::utils::detail
+
+
+#endif
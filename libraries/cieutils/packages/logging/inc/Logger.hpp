@@ -4,6 +4,7 @@
 // --- Internal Includes ---
 #include "cieutils/packages/output/inc/FileManager.hpp"
 #include "cieutils/packages/output/inc/fileinfo.hpp"
+#include "cieutils/packages/logging/inc/AsyncLogWriter.hpp"
 
 #include "cieutils/packages/concepts/inc/streamable.hpp"
 #include "cieutils/packages/concepts/inc/container_concepts.hpp"
@@ -17,6 +18,7 @@
 #include <chrono>
 #include <ctime>
 #include <filesystem>
+#include <mutex>
 
 
 namespace cie::utils {
@@ -60,6 +62,18 @@ public:
     Logger& useConsole( bool use );
     Logger& forceFlush( bool use );
 
+    /**
+     * Write messages on a background thread instead of the calling one.
+     * Messages are queued in a buffer of 'bufferSize' messages, and are only
+     * flushed to the streams on an explicit call to flush() or on destruction.
+     */
+    Logger& asynchronous( bool use,
+                          Size bufferSize = 4096 );
+    bool isAsynchronous() const;
+
+    /// Write queued messages (if asynchronous) and flush all streams
+    Logger& flush();
+
     Logger& log( const std::string& message );
 
     template <class ...Args>
@@ -90,10 +104,14 @@ protected:
     Logger& log(    const std::string& r_message,
                     bool printPrefix );
 
-    Logger& flush();
     std::string decorate(   const std::string& message,
                             bool prefix = true );
-    Logger& printToStreams( const std::string& message );
+    Logger& printToStreams( const std::string& message,
+                            bool flush );
+
+    /// Write to the console (if enabled) and all streams
+    void write( const std::string& r_message,
+                bool flush );
 
     FileManager                 _manager;
     std::deque<StreamPtr>       _streams;
@@ -102,6 +120,9 @@ protected:
     std::string                 _prefix;
     bool                        _useConsole;
     bool                        _forceFlush;
+
+    std::unique_ptr<detail::AsyncLogWriter> _p_asyncWriter;
+    std::mutex                  _streamMutex;
 };
 
 
@@ -0,0 +1,149 @@
+#ifndef CIE_UTILS_LOGGING_PROFILER_HPP
+#define CIE_UTILS_LOGGING_PROFILER_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/logging/inc/Logger.hpp"
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <ostream>
+#include <filesystem>
+#include <limits>
+#include <atomic>
+
+
+namespace cie::utils {
+
+
+class ProfilerScope;
+
+
+/**
+ * @brief Collects timings of nested, named zones on every thread that enters one.
+ * Each thread records its own tree of zones (a zone's children are the zones
+ * entered while it was active), with call counts and total, min and max times.
+ * Results can be written as a flat list (aggregated by zone name over all
+ * threads), as a tree per thread, or as a Chrome trace (chrome://tracing).
+ * @note zones must be entered and exited in a nested manner on each thread, and
+ * reports should only be written while no other thread is inside a zone.
+ */
+class Profiler
+{
+public:
+    friend class ProfilerScope;
+
+    using clock_type = std::chrono::steady_clock;
+
+public:
+    /// @param recordTrace store every zone instance for writeChromeTrace (memory grows with each call)
+    Profiler( bool recordTrace = false );
+
+    /// Write a report to the logger when the profiler is destroyed
+    Profiler( Logger& r_logger,
+              bool recordTrace = false );
+
+    Profiler( const Profiler& r_rhs ) = delete;
+
+    ~Profiler();
+
+    [[nodiscard]] ProfilerScope scope( const std::string& r_name );
+
+    /// Enter a zone on the calling thread (prefer ProfilerScope)
+    void begin( const std::string& r_name );
+
+    /// Exit the last entered zone on the calling thread
+    void end();
+
+    /// Same as end, but returns false instead of throwing if there is no active zone
+    bool endIfActive();
+
+    /// Write the flat and tree reports to the logger
+    void report( Logger& r_logger ) const;
+
+    /// Zones aggregated by name over all threads, sorted by total time
+    void writeFlatReport( std::ostream& r_stream ) const;
+
+    /// Zone tree of each thread
+    void writeTreeReport( std::ostream& r_stream ) const;
+
+    /// Write recorded zone instances in the Chrome trace event format
+    void writeChromeTrace( std::ostream& r_stream ) const;
+    void writeChromeTrace( const std::filesystem::path& r_filePath ) const;
+
+    /// Discard all records
+    void clear();
+
+private:
+    struct Zone
+    {
+        std::string                         name;
+        Zone*                               p_parent = nullptr;
+        std::vector<std::unique_ptr<Zone>>  children;
+        Size                                numberOfCalls = 0;
+        Size                                totalTime     = 0; // [ns]
+        Size                                minTime       = std::numeric_limits<Size>::max();
+        Size                                maxTime       = 0;
+        clock_type::time_point              begin;
+
+        Zone* child( const std::string& r_name );
+    };
+
+    struct TraceEvent
+    {
+        const Zone* p_zone;
+        Size        begin;    // [ns] since the profiler was constructed
+        Size        duration; // [ns]
+    };
+
+    struct ThreadRecord
+    {
+        Size                    index;
+        Zone                    root;
+        Zone*                   p_current;
+        std::deque<TraceEvent>  trace;
+    };
+
+private:
+    /// Record of the calling thread (created on first access)
+    ThreadRecord& threadRecord();
+
+private:
+    const bool                                  _recordTrace;
+    Logger*                                     _p_logger;
+    std::atomic<Size>                           _id;
+    const clock_type::time_point                _begin;
+    std::vector<std::unique_ptr<ThreadRecord>>  _records;
+    std::vector<std::thread::id>                _threadIDs;
+    mutable std::mutex                          _mutex;
+};
+
+
+/// Times a zone of a Profiler from construction to destruction (like LogBlock for loggers)
+class ProfilerScope
+{
+public:
+    ProfilerScope( Profiler& r_profiler,
+                   const std::string& r_name );
+
+    ProfilerScope( ProfilerScope&& r_rhs );
+
+    ProfilerScope( const ProfilerScope& r_rhs ) = delete;
+
+    ~ProfilerScope();
+
+private:
+    Profiler* _p_profiler;
+};
+
+
+} // namespace cie::utils
+
+
+#endif
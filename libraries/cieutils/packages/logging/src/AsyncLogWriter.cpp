@@ -0,0 +1,212 @@
+// --- Internal Includes ---
+#include "cieutils/packages/logging/inc/AsyncLogWriter.hpp"
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <iostream>
+
+
+namespace cie::utils::detail {
+
+
+/* --- LogRingBuffer --- */
+
+LogRingBuffer::LogRingBuffer( Size capacity ) :
+    _mask( 1 ),
+    _pushIndex( 0 ),
+    _popIndex( 0 )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    while ( _mask < capacity )
+        _mask <<= 1;
+
+    _slots.reset( new Slot[_mask] );
+    for ( Size i=0; i<_mask; ++i )
+        _slots[i].sequence.store( i, std::memory_order_relaxed );
+
+    --_mask;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+bool LogRingBuffer::tryPush( std::string&& r_message )
+{
+    Size index = _pushIndex.load( std::memory_order_relaxed );
+
+    while ( true )
+    {
+        Slot& r_slot = _slots[index & _mask];
+        const Size sequence = r_slot.sequence.load( std::memory_order_acquire );
+        const auto difference = static_cast<std::ptrdiff_t>( sequence - index );
+
+        if ( difference == 0 )
+        {
+            // The slot is free -> try to claim it
+            if ( _pushIndex.compare_exchange_weak(index, index + 1, std::memory_order_relaxed) )
+            {
+                r_slot.message = std::move( r_message );
+                r_slot.sequence.store( index + 1, std::memory_order_release );
+                return true;
+            }
+        }
+        else if ( difference < 0 )
+            return false; // the slot still holds a message from the previous round -> full
+        else
+            index = _pushIndex.load( std::memory_order_relaxed );
+    }
+}
+
+
+bool LogRingBuffer::tryPop( std::string& r_message )
+{
+    // Single consumer -> no need to compete for the index
+    const Size index = _popIndex.load( std::memory_order_relaxed );
+    Slot& r_slot = _slots[index & _mask];
+
+    if ( r_slot.sequence.load(std::memory_order_acquire) != index + 1 )
+        return false;
+
+    r_message = std::move( r_slot.message );
+    r_slot.message.clear();
+    _popIndex.store( index + 1, std::memory_order_relaxed );
+
+    // Release the slot for the next round
+    r_slot.sequence.store( index + _mask + 1, std::memory_order_release );
+    return true;
+}
+
+
+Size LogRingBuffer::capacity() const
+{
+    return _mask + 1;
+}
+
+
+/* --- AsyncLogWriter --- */
+
+AsyncLogWriter::AsyncLogWriter( AsyncLogWriter::write_function writeFunction,
+                                Size bufferSize ) :
+    _buffer( bufferSize ),
+    _write( writeFunction ),
+    _numberOfPushedMessages( 0 ),
+    _numberOfWrittenMessages( 0 ),
+    _sleeping( false ),
+    _terminate( false )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    _thread = std::thread( &AsyncLogWriter::run, this );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    _terminate.store( true );
+    {
+        std::scoped_lock<std::mutex> lock( _mutex );
+        _writerCondition.notify_one();
+    }
+
+    if ( _thread.joinable() )
+        _thread.join();
+}
+
+
+void AsyncLogWriter::push( std::string&& r_message )
+{
+    while ( !_buffer.tryPush(std::move(r_message)) )
+    {
+        this->wakeWriter();
+        std::this_thread::yield();
+    }
+
+    ++_numberOfPushedMessages;
+    this->wakeWriter();
+}
+
+
+void AsyncLogWriter::drain()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const Size target = _numberOfPushedMessages.load();
+
+    std::unique_lock<std::mutex> lock( _mutex );
+    _writerCondition.notify_one();
+    _drainCondition.wait(
+        lock,
+        [this, target]() { return target <= _numberOfWrittenMessages.load(); }
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void AsyncLogWriter::run()
+{
+    std::string batch;
+    std::string message;
+
+    while ( true )
+    {
+        // Collect everything that's in the buffer
+        Size numberOfMessages = 0;
+        while ( _buffer.tryPop(message) )
+        {
+            batch += message;
+            ++numberOfMessages;
+        }
+
+        if ( numberOfMessages )
+        {
+            try
+            {
+                _write( batch );
+            }
+            catch ( const std::exception& r_exception )
+            {
+                std::cerr << r_exception.what() << '\n';
+            }
+
+            batch.clear();
+
+            std::scoped_lock<std::mutex> lock( _mutex );
+            _numberOfWrittenMessages += numberOfMessages;
+            _drainCondition.notify_all();
+            continue;
+        }
+
+        // Nothing to write -> terminate or sleep until there is
+        std::unique_lock<std::mutex> lock( _mutex );
+        if ( _terminate.load() && _numberOfWrittenMessages.load() == _numberOfPushedMessages.load() )
+            break;
+
+        // Producers count their message before checking the flag, and the predicate
+        // is checked after setting it => either the writer sees the new message,
+        // or the producer sees the flag and notifies (under the mutex, so not
+        // before the writer waits)
+        _sleeping.store( true );
+        _writerCondition.wait(
+            lock,
+            [this]() { return _terminate.load() || _numberOfPushedMessages.load() != _numberOfWrittenMessages.load(); }
+        );
+        _sleeping.store( false );
+    }
+}
+
+
+void AsyncLogWriter::wakeWriter()
+{
+    if ( _sleeping.load() )
+    {
+        std::scoped_lock<std::mutex> lock( _mutex );
+        _writerCondition.notify_one();
+    }
+}
+
+
+} // namespace cie::utils::detail
@@ -13,7 +13,11 @@ LogBlock::LogBlock( const std::string& r_name,
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    r_logger.separate().log( "> " + _name ).increaseIndent().flush();
+    r_logger.separate().log( "> " + _name ).increaseIndent();
+
+    // Asynchronous loggers are only flushed on request
+    if ( !r_logger.isAsynchronous() )
+        r_logger.flush();
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -23,7 +27,10 @@ LogBlock::~LogBlock()
 {
     _r_logger.decreaseIndent();
     logElapsed( "< " + _name + " |", false );
-    _r_logger.separate().flush();
+    _r_logger.separate();
+
+    if ( !_r_logger.isAsynchronous() )
+        _r_logger.flush();
 }
 
 
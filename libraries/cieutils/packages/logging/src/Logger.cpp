@@ -64,6 +64,9 @@ Logger::~Logger()
     logElapsed( "\nLogger ran for", 0, false );
     logDate( "Log file closed on" );
     flush();
+
+    // Join the writer thread before the streams are destroyed
+    _p_asyncWriter.reset();
 }
 
 
@@ -85,8 +88,11 @@ Logger& Logger::addStream( StreamPtr stream )
                             _streams.end(),
                             stream );
 
-    if (it == _streams.end())   
+    if (it == _streams.end())
+    {
+        std::scoped_lock<std::mutex> lock( _streamMutex );
         _streams.push_back(stream);
+    }
 
     return *this;
 
@@ -102,8 +108,15 @@ Logger& Logger::removeStream( StreamPtr stream )
                             _streams.end(),
                             stream );
 
-    if (it != _streams.end() && it!=_streams.begin())   
+    if (it != _streams.end() && it!=_streams.begin())
+    {
+        // Write pending messages to the stream before removing it
+        if ( _p_asyncWriter )
+            _p_asyncWriter->drain();
+
+        std::scoped_lock<std::mutex> lock( _streamMutex );
         _streams.erase(it);
+    }
 
     return *this;
 
@@ -125,6 +138,34 @@ Logger& Logger::forceFlush( bool use )
 }
 
 
+Logger& Logger::asynchronous( bool use,
+                              Size bufferSize )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( use && !_p_asyncWriter )
+        _p_asyncWriter = std::make_unique<detail::AsyncLogWriter>(
+            [this]( const std::string& r_batch ) { this->write( r_batch, false ); },
+            bufferSize
+        );
+    else if ( !use && _p_asyncWriter )
+    {
+        _p_asyncWriter->drain();
+        _p_asyncWriter.reset();
+    }
+
+    return *this;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+bool Logger::isAsynchronous() const
+{
+    return bool( _p_asyncWriter );
+}
+
+
 Logger& Logger::log( const std::string& message )
 {
     CIE_BEGIN_EXCEPTION_TRACING
@@ -300,16 +341,13 @@ Logger& Logger::log(    const std::string& message,
     // Get decorated message
     std::string msg = decorate( message, printPrefix );
 
-    // Print to console if enabled
-    if (_useConsole)
-    {
-        std::cout << msg;
-        if (_forceFlush)
-            std::flush(std::cout);
-    }
+    // Leave the output to the writer thread if asynchronous
+    if ( _p_asyncWriter )
+        _p_asyncWriter->push( std::move(msg) );
+    else
+        this->write( msg, _forceFlush );
 
-    // Streams
-    return printToStreams( msg );
+    return *this;
 
     CIE_END_EXCEPTION_TRACING
 }
@@ -319,6 +357,11 @@ Logger& Logger::flush()
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
+    if ( _p_asyncWriter )
+        _p_asyncWriter->drain();
+
+    std::scoped_lock<std::mutex> lock( _streamMutex );
+
     std::flush( std::cout );
 
     for ( auto& stream : _streams )
@@ -337,16 +380,19 @@ std::string Logger::decorate(   const std::string& message,
 }
 
 
-Logger& Logger::printToStreams( const std::string& message )
+Logger& Logger::printToStreams( const std::string& message,
+                                bool flush )
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
+    std::scoped_lock<std::mutex> lock( _streamMutex );
+
     for ( auto& stream : _streams )
     {
         try
         {
             *stream << message;
-            if (_forceFlush)
+            if (flush)
                 std::flush(*stream);
         }
         catch(const std::exception& e)
@@ -361,6 +407,27 @@ Logger& Logger::printToStreams( const std::string& message )
 
 
 
+void Logger::write( const std::string& r_message,
+                    bool flush )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Print to console if enabled
+    if (_useConsole)
+    {
+        std::cout << r_message;
+        if (flush)
+            std::flush(std::cout);
+    }
+
+    // Streams
+    printToStreams( r_message, flush );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+
 Logger& operator<<( Logger& r_logger, const std::string& r_message )
 {
     CIE_BEGIN_EXCEPTION_TRACING
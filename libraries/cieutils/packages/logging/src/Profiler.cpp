@@ -0,0 +1,440 @@
+// --- Internal Includes ---
+#include "cieutils/packages/logging/inc/Profiler.hpp"
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+
+
+namespace cie::utils {
+
+
+namespace {
+
+/// Unique identifier of each Profiler (and each of its clears), to validate cached thread records
+std::atomic<Size> profilerCounter = 0;
+
+/// Last thread record accessed by the current thread
+struct CachedThreadRecord
+{
+    Size  profilerID = std::numeric_limits<Size>::max();
+    void* p_record   = nullptr;
+};
+
+thread_local CachedThreadRecord cachedThreadRecord;
+
+
+double toMilliseconds( Size nanoseconds )
+{
+    return 1e-6 * double(nanoseconds);
+}
+
+
+std::string escapeJSON( const std::string& r_string )
+{
+    std::string escaped;
+    escaped.reserve( r_string.size() );
+
+    for ( char c : r_string )
+    {
+        if ( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+
+    return escaped;
+}
+
+} // namespace
+
+
+/* --- Profiler::Zone --- */
+
+Profiler::Zone* Profiler::Zone::child( const std::string& r_name )
+{
+    for ( auto& rp_child : this->children )
+        if ( rp_child->name == r_name )
+            return rp_child.get();
+
+    auto& rp_child = this->children.emplace_back( new Zone );
+    rp_child->name     = r_name;
+    rp_child->p_parent = this;
+    return rp_child.get();
+}
+
+
+/* --- Profiler --- */
+
+Profiler::Profiler( bool recordTrace ) :
+    _recordTrace( recordTrace ),
+    _p_logger( nullptr ),
+    _id( profilerCounter++ ),
+    _begin( clock_type::now() )
+{
+}
+
+
+Profiler::Profiler( Logger& r_logger,
+                    bool recordTrace ) :
+    Profiler( recordTrace )
+{
+    _p_logger = &r_logger;
+}
+
+
+Profiler::~Profiler()
+{
+    if ( _p_logger )
+    {
+        try
+        {
+            this->report( *_p_logger );
+        }
+        catch ( ... )
+        {
+        }
+    }
+}
+
+
+ProfilerScope Profiler::scope( const std::string& r_name )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return ProfilerScope( *this, r_name );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::begin( const std::string& r_name )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    auto& r_record = this->threadRecord();
+
+    r_record.p_current = r_record.p_current->child( r_name );
+    r_record.p_current->begin = clock_type::now();
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::end()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( !this->endIfActive() )
+        CIE_THROW( Exception, "No active zone to end" )
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+bool Profiler::endIfActive()
+{
+    const auto time = clock_type::now();
+
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    auto& r_record = this->threadRecord();
+    Zone* p_zone   = r_record.p_current;
+
+    if ( !p_zone->p_parent )
+        return false;
+
+    const Size duration = std::chrono::duration_cast<std::chrono::nanoseconds>( time - p_zone->begin ).count();
+
+    ++p_zone->numberOfCalls;
+    p_zone->totalTime += duration;
+    p_zone->minTime    = std::min( p_zone->minTime, duration );
+    p_zone->maxTime    = std::max( p_zone->maxTime, duration );
+
+    if ( _recordTrace )
+        r_record.trace.push_back( {
+            p_zone,
+            Size( std::chrono::duration_cast<std::chrono::nanoseconds>(p_zone->begin - _begin).count() ),
+            duration
+        } );
+
+    r_record.p_current = p_zone->p_parent;
+    return true;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::report( Logger& r_logger ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::stringstream stream;
+    stream << "Profiler report\n";
+    this->writeFlatReport( stream );
+    stream << '\n';
+    this->writeTreeReport( stream );
+
+    r_logger.log( stream.str() );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::writeFlatReport( std::ostream& r_stream ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::scoped_lock<std::mutex> lock( _mutex );
+
+    // Aggregate zones by name
+    struct Entry
+    {
+        std::string name;
+        Size        numberOfCalls = 0;
+        Size        totalTime     = 0;
+        Size        minTime       = std::numeric_limits<Size>::max();
+        Size        maxTime       = 0;
+    };
+
+    std::vector<Entry> entries;
+    std::unordered_map<std::string,Size> entryIndices;
+
+    auto collect = [&entries, &entryIndices]( const Zone& r_zone, auto& r_collect ) -> void
+    {
+        for ( const auto& rp_child : r_zone.children )
+        {
+            auto [it, inserted] = entryIndices.emplace( rp_child->name, entries.size() );
+            if ( inserted )
+                entries.emplace_back().name = rp_child->name;
+
+            Entry& r_entry = entries[it->second];
+            r_entry.numberOfCalls += rp_child->numberOfCalls;
+            r_entry.totalTime     += rp_child->totalTime;
+            r_entry.minTime        = std::min( r_entry.minTime, rp_child->minTime );
+            r_entry.maxTime        = std::max( r_entry.maxTime, rp_child->maxTime );
+
+            r_collect( *rp_child, r_collect );
+        }
+    };
+
+    for ( const auto& rp_record : _records )
+        collect( rp_record->root, collect );
+
+    std::sort(
+        entries.begin(),
+        entries.end(),
+        []( const Entry& r_lhs, const Entry& r_rhs ) { return r_rhs.totalTime < r_lhs.totalTime; }
+    );
+
+    const auto flags     = r_stream.flags();
+    const auto precision = r_stream.precision();
+
+    r_stream << std::left << std::setw(40) << "zone" << std::right
+             << std::setw(10) << "calls"
+             << std::setw(14) << "total [ms]"
+             << std::setw(14) << "mean [ms]"
+             << std::setw(14) << "min [ms]"
+             << std::setw(14) << "max [ms]" << '\n'
+             << std::fixed << std::setprecision(3);
+
+    for ( const auto& r_entry : entries )
+    {
+        if ( !r_entry.numberOfCalls )
+            continue;
+
+        r_stream << std::left << std::setw(40) << r_entry.name << std::right
+                 << std::setw(10) << r_entry.numberOfCalls
+                 << std::setw(14) << toMilliseconds( r_entry.totalTime )
+                 << std::setw(14) << toMilliseconds( r_entry.totalTime ) / r_entry.numberOfCalls
+                 << std::setw(14) << toMilliseconds( r_entry.minTime )
+                 << std::setw(14) << toMilliseconds( r_entry.maxTime ) << '\n';
+    }
+
+    r_stream.flags( flags );
+    r_stream.precision( precision );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::writeTreeReport( std::ostream& r_stream ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::scoped_lock<std::mutex> lock( _mutex );
+
+    const auto flags     = r_stream.flags();
+    const auto precision = r_stream.precision();
+
+    r_stream << std::fixed << std::setprecision(3);
+
+    auto write = [&r_stream]( const Zone& r_zone, Size depth, auto& r_write ) -> void
+    {
+        // Total time of the parent for computing percentages (sum of children for the root)
+        Size parentTime = r_zone.totalTime;
+        if ( !r_zone.p_parent )
+            for ( const auto& rp_child : r_zone.children )
+                parentTime += rp_child->totalTime;
+
+        for ( const auto& rp_child : r_zone.children )
+        {
+            if ( !rp_child->numberOfCalls )
+                continue;
+
+            const std::string label = std::string( 2 * depth, ' ' ) + rp_child->name;
+            r_stream << std::left << std::setw(40) << label << std::right
+                     << std::setw(10) << rp_child->numberOfCalls
+                     << std::setw(14) << toMilliseconds( rp_child->totalTime )
+                     << std::setw(10) << ( parentTime ? 100.0 * rp_child->totalTime / parentTime : 0.0 ) << " %"
+                     << '\n';
+
+            r_write( *rp_child, depth + 1, r_write );
+        }
+    };
+
+    for ( const auto& rp_record : _records )
+    {
+        r_stream << std::left << std::setw(40) << ( "thread " + std::to_string(rp_record->index) ) << std::right
+                 << std::setw(10) << "calls"
+                 << std::setw(14) << "total [ms]"
+                 << std::setw(12) << "parent" << '\n';
+        write( rp_record->root, 1, write );
+    }
+
+    r_stream.flags( flags );
+    r_stream.precision( precision );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::writeChromeTrace( std::ostream& r_stream ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::scoped_lock<std::mutex> lock( _mutex );
+
+    const auto flags     = r_stream.flags();
+    const auto precision = r_stream.precision();
+
+    r_stream << "{\"traceEvents\":[" << std::fixed << std::setprecision(3);
+
+    bool first = true;
+    for ( const auto& rp_record : _records )
+        for ( const auto& r_event : rp_record->trace )
+        {
+            if ( !first )
+                r_stream << ',';
+            first = false;
+
+            r_stream << "\n{\"name\":\"" << escapeJSON( r_event.p_zone->name ) << "\""
+                     << ",\"cat\":\"cie\",\"ph\":\"X\""
+                     << ",\"ts\":" << 1e-3 * r_event.begin
+                     << ",\"dur\":" << 1e-3 * r_event.duration
+                     << ",\"pid\":0,\"tid\":" << rp_record->index << '}';
+        }
+
+    r_stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    r_stream.flags( flags );
+    r_stream.precision( precision );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::writeChromeTrace( const std::filesystem::path& r_filePath ) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::ofstream file( r_filePath );
+    if ( !file )
+        CIE_THROW( Exception, "Failed to open " + r_filePath.string() )
+
+    this->writeChromeTrace( file );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void Profiler::clear()
+{
+    std::scoped_lock<std::mutex> lock( _mutex );
+
+    _records.clear();
+    _threadIDs.clear();
+
+    // Invalidate the records cached by threads
+    _id = profilerCounter++;
+}
+
+
+Profiler::ThreadRecord& Profiler::threadRecord()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( cachedThreadRecord.profilerID == _id )
+        return *static_cast<ThreadRecord*>( cachedThreadRecord.p_record );
+
+    std::scoped_lock<std::mutex> lock( _mutex );
+
+    const auto threadID = std::this_thread::get_id();
+    auto it = std::find( _threadIDs.begin(), _threadIDs.end(), threadID );
+
+    ThreadRecord* p_record = nullptr;
+
+    if ( it == _threadIDs.end() )
+    {
+        auto& rp_record = _records.emplace_back( new ThreadRecord );
+        rp_record->index     = _records.size() - 1;
+        rp_record->p_current = &rp_record->root;
+        _threadIDs.push_back( threadID );
+        p_record = rp_record.get();
+    }
+    else
+        p_record = _records[std::distance(_threadIDs.begin(), it)].get();
+
+    cachedThreadRecord.profilerID = _id;
+    cachedThreadRecord.p_record   = p_record;
+
+    return *p_record;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+/* --- ProfilerScope --- */
+
+ProfilerScope::ProfilerScope( Profiler& r_profiler,
+                              const std::string& r_name ) :
+    _p_profiler( &r_profiler )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    r_profiler.begin( r_name );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+ProfilerScope::ProfilerScope( ProfilerScope&& r_rhs ) :
+    _p_profiler( r_rhs._p_profiler )
+{
+    r_rhs._p_profiler = nullptr;
+}
+
+
+ProfilerScope::~ProfilerScope()
+{
+    // The zone is gone if the profiler was cleared in the meantime
+    if ( _p_profiler )
+        _p_profiler->endIfActive();
+}
+
+
+} // namespace cie::utils
@@ -0,0 +1,98 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/logging/inc/Profiler.hpp"
+#include "cmake_variables.hpp"
+
+// --- STL Includes ---
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+namespace cie::utils {
+
+
+CIE_TEST_CASE( "Profiler", "[logging]" )
+{
+    CIE_TEST_CASE_INIT( "Profiler" )
+
+    std::filesystem::path loggerTestDir = TEST_OUTPUT_PATH;
+    Logger logger( loggerTestDir / "Profiler_test.log" );
+
+    {
+        Profiler profiler( logger, true );
+
+        // Unbalanced end
+        CIE_TEST_CHECK_THROWS( profiler.end() );
+
+        auto work = [&profiler]() -> void
+        {
+            auto outer = profiler.scope( "outer" );
+            for ( Size i=0; i<3; ++i )
+            {
+                auto inner = profiler.scope( "inner" );
+                std::this_thread::sleep_for( std::chrono::microseconds(10) );
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for ( Size i=0; i<2; ++i )
+            threads.emplace_back( work );
+        for ( auto& r_thread : threads )
+            r_thread.join();
+        work();
+
+        std::stringstream flat;
+        CIE_TEST_CHECK_NOTHROW( profiler.writeFlatReport(flat) );
+        CIE_TEST_CHECK( flat.str().find("outer") != std::string::npos );
+        CIE_TEST_CHECK( flat.str().find("inner") != std::string::npos );
+
+        // 3 threads x 3 calls
+        std::string line;
+        while ( std::getline(flat, line) )
+            if ( line.rfind("inner", 0) == 0 )
+            {
+                std::stringstream columns( line.substr(5) );
+                Size numberOfCalls = 0;
+                columns >> numberOfCalls;
+                CIE_TEST_CHECK( numberOfCalls == 9 );
+            }
+
+        std::stringstream tree;
+        CIE_TEST_CHECK_NOTHROW( profiler.writeTreeReport(tree) );
+        CIE_TEST_CHECK( tree.str().find("thread 2") != std::string::npos );
+        CIE_TEST_CHECK( tree.str().find("\n    inner") != std::string::npos );
+
+        std::stringstream trace;
+        CIE_TEST_CHECK_NOTHROW( profiler.writeChromeTrace(trace) );
+        const std::string traceString = trace.str();
+        CIE_TEST_CHECK( traceString.rfind("{\"traceEvents\":[", 0) == 0 );
+
+        Size numberOfEvents = 0;
+        for ( Size position=traceString.find("\"ph\":\"X\""); position!=std::string::npos; position=traceString.find("\"ph\":\"X\"", position+1) )
+            ++numberOfEvents;
+        CIE_TEST_CHECK( numberOfEvents == 3 * (1 + 3) );
+
+        CIE_TEST_CHECK_NOTHROW( profiler.writeChromeTrace(loggerTestDir / "Profiler_test_trace.json") );
+
+        profiler.clear();
+        std::stringstream empty;
+        profiler.writeFlatReport( empty );
+        CIE_TEST_CHECK( empty.str().find("inner") == std::string::npos );
+
+        {
+            auto scope = profiler.scope( "after clear" );
+        }
+
+        // Clearing while a scope is open must not throw from its destructor
+        {
+            auto scope = profiler.scope( "cleared" );
+            profiler.clear();
+        }
+        CIE_TEST_CHECK_THROWS( profiler.end() );
+        CIE_TEST_CHECK( !profiler.endIfActive() );
+    } // <-- report to the logger
+}
+
+
+} // namespace cie::utils
@@ -3,6 +3,12 @@
 #include "cieutils/packages/logging/inc/Logger.hpp"
 #include "cmake_variables.hpp"
 
+// --- STL Includes ---
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
 
 namespace cie::utils {
 
@@ -34,6 +40,46 @@ CIE_TEST_CASE( "Logger", "[logger]" )
         CIE_TEST_CHECK_NOTHROW( logger.noIndent() );
         CIE_TEST_CHECK_NOTHROW( logger.logElapsed( "test7", timerID ) );
     }
+
+    {
+        CIE_TEST_CASE_INIT( "asynchronous" )
+
+        const Size numberOfThreads  = 4;
+        const Size numberOfMessages = 1000;
+
+        auto p_stream = std::make_shared<std::stringstream>();
+
+        Logger logger( loggerTestDir / "testAsyncLog.txt" );
+        CIE_TEST_CHECK( !logger.isAsynchronous() );
+        CIE_TEST_CHECK_NOTHROW( logger.asynchronous( true, 16 ) );
+        CIE_TEST_CHECK( logger.isAsynchronous() );
+        CIE_TEST_CHECK_NOTHROW( logger.addStream( p_stream ) );
+
+        // Log from several threads at once (the buffer is much smaller than the number of messages)
+        std::vector<std::thread> threads;
+        for ( Size i=0; i<numberOfThreads; ++i )
+            threads.emplace_back( [&logger, i]()
+            {
+                for ( Size j=0; j<numberOfMessages; ++j )
+                    logger.log( "thread " + std::to_string(i) + " message " + std::to_string(j) );
+            } );
+
+        for ( auto& r_thread : threads )
+            r_thread.join();
+
+        CIE_TEST_CHECK_NOTHROW( logger.flush() );
+
+        const std::string output = p_stream->str();
+        CIE_TEST_CHECK( Size(std::count(output.begin(), output.end(), '\n')) == numberOfThreads * numberOfMessages );
+
+        // Messages from the same thread keep their order
+        CIE_TEST_CHECK( output.find("thread 0 message 998") < output.find("thread 0 message 999") );
+
+        CIE_TEST_CHECK_NOTHROW( logger.log( "last message" ) );
+        CIE_TEST_CHECK_NOTHROW( logger.asynchronous( false ) );
+        CIE_TEST_CHECK( !logger.isAsynchronous() );
+        CIE_TEST_CHECK( p_stream->str().find("last message") != std::string::npos );
+    }
 }
 
 
@@ -13,6 +13,17 @@
 
 /* The preprocessor variables can be defined/undefined through CMake */
 
+/**
+ * Check levels (CIE_CHECK_LEVEL), each including the previous ones:
+ *  0: CIE_CHECK, CIE_CHECK_POINTER
+ *  1: CIE_DIVISION_BY_ZERO_CHECK, CIE_RUNTIME_GEOMETRY_CHECK
+ *  2: CIE_OUT_OF_RANGE_CHECK
+ * Checks above level 0 must be enabled by their own variable as well.
+ */
+#ifndef CIE_CHECK_LEVEL
+    #define CIE_CHECK_LEVEL 2
+#endif
+
 
 #define CIE_CHECK( boolExpression, message )                        \
     if ( !(boolExpression) )  [[unlikely]]                          \
@@ -26,7 +37,7 @@
     }
 
 
-#ifdef CIE_ENABLE_OUT_OF_RANGE_TESTS
+#if defined(CIE_ENABLE_OUT_OF_RANGE_TESTS) && 1 < CIE_CHECK_LEVEL
     #define CIE_OUT_OF_RANGE_CHECK(boolExpression)                  \
         if (!(boolExpression)) [[unlikely]]                         \
         {                                                           \
@@ -39,7 +50,7 @@
 #endif
 
 
-#ifdef CIE_ENABLE
+#if defined(CIE_ENABLE_DIVISION_BY_ZERO_CHECKS) && 0 < CIE_CHECK_LEVEL
     #define CIE_DIVISION_BY_ZERO_CHECK(boolExpression)                  \
         if (!(boolExpression)) [[unlikely]]                             \
         {                                                               \
@@ -52,7 +63,7 @@
 #endif
 
 
-#ifdef CIE_ENABLE_RUNTIME_GEOMETRY_CHECKS
+#if defined(CIE_ENABLE_RUNTIME_GEOMETRY_CHECKS) && 0 < CIE_CHECK_LEVEL
     #define CIE_RUNTIME_GEOMETRY_CHECK(boolExpression, message)         \
         if (!(boolExpression)) [[unlikely]]                             \
         {                                                               \
@@ -61,27 +61,13 @@ Exception makeException(    const String& r_location,
     #define CIE_BEGIN_EXCEPTION_TRACING                                     \
         try {
 
+    // A single handler with an out-of-line call keeps traced functions small
+    // enough to be inlined; the location is only added to the message on throw
     #define CIE_END_EXCEPTION_TRACING                                       \
         }                                                                   \
-        catch ( const cie::Exception& EXCEPTION )                           \
-        {                                                                   \
-            throw cie::Exception(                                           \
-                CIE_CODE_LOCATION,                                          \
-                EXCEPTION.what(),                                           \
-                EXCEPTION.stackLevel() + 1                                  \
-            );                                                              \
-        }                                                                   \
-        catch ( const std::exception& EXCEPTION )                           \
-        {                                                                   \
-            throw cie::detail::makeException<cie::Exception>(               \
-                CIE_CODE_LOCATION,                                          \
-                EXCEPTION.what(),                                           \
-                "std::exception"                                            \
-            );                                                              \
-        }                                                                   \
         catch ( ... )                                                       \
         {                                                                   \
-            CIE_THROW( cie::Exception, "Unknown exception" )                \
+            cie::detail::rethrowTraced( CIE_CODE_LOCATION );                \
         }
 
 #else
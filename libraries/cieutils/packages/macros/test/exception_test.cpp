@@ -2,6 +2,9 @@
 #include "cieutils/packages/testing/inc/essentials.hpp"
 #include "cieutils/packages/macros/inc/exceptions.hpp"
 
+// --- STL Includes ---
+#include <stdexcept>
+
 
 namespace cie {
 
@@ -22,6 +25,23 @@ void testFunction()
     CIE_END_EXCEPTION_TRACING
 }
 
+void testSTLException()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    throw std::runtime_error( "test" );
+    CIE_END_EXCEPTION_TRACING
+}
+
+void testRecursion( Size depth )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    if ( depth )
+        testRecursion( depth - 1 );
+    else
+        CIE_THROW( Exception, "test" )
+    CIE_END_EXCEPTION_TRACING
+}
+
 } // namespace exception
 
 
@@ -41,7 +61,46 @@ CIE_TEST_CASE( "Exception tracing", "[macros]" )
     {
         std::cout << r_exception.what() << std::endl;
     }
-    
+
+    #ifdef CIE_ENABLE_EXCEPTION_TRACING
+    {
+        CIE_TEST_CASE_INIT( "trace" )
+
+        // The type of CIE exceptions is preserved
+        CIE_TEST_CHECK_THROWS_AS( exception::testFunction(), DivisionByZeroException );
+
+        String message;
+        try
+        {
+            exception::testFunction();
+        }
+        catch ( const Exception& r_exception )
+        {
+            CIE_TEST_CHECK( r_exception.stackLevel() == 2 );
+            message = r_exception.what();
+        }
+
+        CIE_TEST_CHECK( message.find("(Exception stack 2)") == 0 );
+        CIE_TEST_CHECK( message.find("(Exception stack 1)") != message.npos );
+        CIE_TEST_CHECK( message.find("(Exception stack 0)") != message.npos );
+        CIE_TEST_CHECK( message.find("test") != message.npos );
+
+        // Each traced level terminates the nested message with a newline
+        CIE_TEST_CHECK( message.ends_with("\n\n\n") );
+
+        try
+        {
+            exception::testRecursion( 500 );
+        }
+        catch ( const Exception& r_exception )
+        {
+            CIE_TEST_CHECK( r_exception.stackLevel() == 501 );
+        }
+
+        // Other exceptions are converted
+        CIE_TEST_CHECK_THROWS_AS( exception::testSTLException(), Exception );
+    }
+    #endif
 }
 
 
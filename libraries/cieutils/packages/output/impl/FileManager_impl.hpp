@@ -0,0 +1,40 @@
+#ifndef CIEUTILS_FILEMANAGER_IMPL_HPP
+#define CIEUTILS_FILEMANAGER_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+
+namespace cie::utils {
+
+
+template <class ValueType>
+inline MappedArray<ValueType>
+FileManager::newMappedArray( const std::filesystem::path& r_filePath,
+                             Size size )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return MappedArray<ValueType>( this->newMappedFile( r_filePath, size * sizeof(ValueType) ) );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+inline MappedArray<ValueType>
+FileManager::openMappedArray( const std::filesystem::path& r_filePath,
+                              MappedFile::Mode mode )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    return MappedArray<ValueType>( this->openMappedFile( r_filePath, mode ) );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+} // namespace cie::utils
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,155 @@
+#ifndef CIEUTILS_MAPPED_FILE_IMPL_HPP
+#define CIEUTILS_MAPPED_FILE_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+#include "cieutils/packages/macros/inc/checks.hpp"
+
+
+namespace cie::utils {
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+MappedArray<ValueType>::MappedArray( MappedFilePtr p_file ) :
+    _p_file( p_file )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK_POINTER( _p_file )
+    CIE_CHECK(
+        _p_file->size() % sizeof(ValueType) == 0,
+        "Size of " + _p_file->path().string() + " is not a multiple of the value size"
+    )
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline void
+MappedArray<ValueType>::resize( Size size )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    _p_file->resize( size * sizeof(ValueType) );
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline void
+MappedArray<ValueType>::sync( bool blocking )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    _p_file->sync( blocking );
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline Size
+MappedArray<ValueType>::size() const
+{
+    return _p_file->size() / sizeof(ValueType);
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline bool
+MappedArray<ValueType>::empty() const
+{
+    return this->size() == 0;
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline ValueType*
+MappedArray<ValueType>::data()
+{
+    return static_cast<ValueType*>( _p_file->data() );
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline const ValueType*
+MappedArray<ValueType>::data() const
+{
+    return static_cast<const ValueType*>( _p_file->data() );
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline ValueType&
+MappedArray<ValueType>::operator[]( Size index )
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return this->data()[index];
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline const ValueType&
+MappedArray<ValueType>::operator[]( Size index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return this->data()[index];
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline typename MappedArray<ValueType>::iterator
+MappedArray<ValueType>::begin()
+{
+    return this->data();
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline typename MappedArray<ValueType>::iterator
+MappedArray<ValueType>::end()
+{
+    return this->data() + this->size();
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline typename MappedArray<ValueType>::const_iterator
+MappedArray<ValueType>::begin() const
+{
+    return this->data();
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline typename MappedArray<ValueType>::const_iterator
+MappedArray<ValueType>::end() const
+{
+    return this->data() + this->size();
+}
+
+
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+inline const MappedFilePtr&
+MappedArray<ValueType>::file() const
+{
+    return _p_file;
+}
+
+
+} // namespace cie::utils
+
+
+#endif
\ No newline at end of file
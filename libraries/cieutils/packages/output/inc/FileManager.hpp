@@ -1,6 +1,9 @@
 #ifndef CIEUTILS_FILEMANAGER_HPP
 #define CIEUTILS_FILEMANAGER_HPP
 
+// --- Internal Includes ---
+#include "cieutils/packages/output/inc/MappedFile.hpp"
+
 // --- STL Includes ---
 #include <fstream>
 #include <vector>
@@ -29,6 +32,27 @@ public:
                    std::ios_base::openmode openMode );
     File& open( const std::filesystem::path& r_filePath );
 
+    /**
+     * Create a memory mapped file of 'size' bytes (preallocated) for reading and writing.
+     * @note mapped files are not registered: they are closed when the last pointer is released
+     */
+    MappedFilePtr newMappedFile( const std::filesystem::path& r_filePath,
+                                 Size size );
+
+    /// Map an existing file
+    MappedFilePtr openMappedFile( const std::filesystem::path& r_filePath,
+                                  MappedFile::Mode mode = MappedFile::Mode::Read );
+
+    /// Create a memory mapped file holding 'size' values
+    template <class ValueType>
+    MappedArray<ValueType> newMappedArray( const std::filesystem::path& r_filePath,
+                                           Size size );
+
+    /// Map an existing file as an array of values
+    template <class ValueType>
+    MappedArray<ValueType> openMappedArray( const std::filesystem::path& r_filePath,
+                                            MappedFile::Mode mode = MappedFile::Mode::Read );
+
     FilePtr filePtr( const File& file );
 
     void deleteFile(const std::filesystem::path& r_filePath );
@@ -47,5 +71,6 @@ private:
 
 } // namespace cie::utils
 
+#include "cieutils/packages/output/impl/FileManager_impl.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef CIEUTILS_MAPPED_FILE_HPP
+#define CIEUTILS_MAPPED_FILE_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <filesystem>
+#include <memory>
+#include <type_traits>
+
+
+namespace cie::utils {
+
+
+/**
+ * @brief File mapped into memory (POSIX mmap).
+ * Reads and writes go directly through the page cache, without stream buffering
+ * or formatting. Changes are written back to the file by the OS, or explicitly by sync.
+ * @note on platforms without mmap, constructors throw.
+ */
+class MappedFile
+{
+public:
+    enum class Mode
+    {
+        Read,
+        ReadWrite
+    };
+
+public:
+    /// Map an existing file
+    MappedFile( const std::filesystem::path& r_filePath,
+                Mode mode = Mode::Read );
+
+    /// Create a file of 'size' bytes (overwrites existing ones) and map it for reading and writing
+    MappedFile( const std::filesystem::path& r_filePath,
+                Size size );
+
+    MappedFile( MappedFile&& r_rhs );
+
+    MappedFile( const MappedFile& r_rhs ) = delete;
+
+    MappedFile& operator=( MappedFile&& r_rhs );
+
+    MappedFile& operator=( const MappedFile& r_rhs ) = delete;
+
+    /// Unmap and close the file (without waiting for the changes to reach the disk)
+    ~MappedFile();
+
+    /**
+     * Change the size of the file and remap it (invalidates pointers to the mapped data)
+     * @note if resizing fails, the current size of the file is mapped (or nothing if that fails too)
+     */
+    void resize( Size size );
+
+    /**
+     * Write changes back to the file.
+     * @param blocking wait until the changes reach the disk (MS_SYNC) or only schedule them (MS_ASYNC)
+     */
+    void sync( bool blocking = true );
+
+    void* data();
+    const void* data() const;
+
+    /// Size of the file in bytes
+    Size size() const;
+
+    bool writable() const;
+
+    const std::filesystem::path& path() const;
+
+private:
+    void map();
+
+    void unmap();
+
+    void close();
+
+private:
+    std::filesystem::path _path;
+    Mode                  _mode;
+    int                   _fileDescriptor;
+    void*                 _p_data;
+    Size                  _size;
+};
+
+
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
+
+/**
+ * @brief Typed array view of a mapped file (the file holds the raw bytes of the values).
+ * @note only trivially copyable types can be stored this way, and files are not
+ * portable between platforms with different endianness or type layouts.
+ */
+template <class ValueType>
+requires std::is_trivially_copyable_v<ValueType>
+class MappedArray
+{
+public:
+    using value_type        = ValueType;
+    using size_type         = Size;
+    using iterator          = ValueType*;
+    using const_iterator    = const ValueType*;
+
+public:
+    MappedArray( MappedFilePtr p_file );
+
+    /// Change the number of values (invalidates iterators)
+    void resize( Size size );
+
+    /// Write changes back to the file (see MappedFile::sync)
+    void sync( bool blocking = true );
+
+    Size size() const;
+    bool empty() const;
+
+    ValueType* data();
+    const ValueType* data() const;
+
+    ValueType& operator[]( Size index );
+    const ValueType& operator[]( Size index ) const;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    const MappedFilePtr& file() const;
+
+private:
+    MappedFilePtr _p_file;
+};
+
+
+} // namespace cie::utils
+
+#include "cieutils/packages/output/impl/MappedFile_impl.hpp"
+
+#endif
\ No newline at end of file
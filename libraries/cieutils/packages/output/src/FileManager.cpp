@@ -136,6 +136,36 @@ File& FileManager::open( const std::filesystem::path& r_filePath )
 }
 
 
+MappedFilePtr FileManager::newMappedFile( const std::filesystem::path& r_filePath,
+                                          Size size )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    auto filePath = this->filePath( r_filePath );
+    this->createPath( detail::fileDirectory( filePath ) );
+
+    return std::make_shared<MappedFile>( filePath, size );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+MappedFilePtr FileManager::openMappedFile( const std::filesystem::path& r_filePath,
+                                           MappedFile::Mode mode )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    auto path = this->filePath( r_filePath );
+
+    if ( !detail::isFile(path) )
+        CIE_THROW( Exception, "Path not found: " + path.string() )
+
+    return std::make_shared<MappedFile>( path, mode );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
 FilePtr FileManager::filePtr( const File& file )
 {
     CIE_BEGIN_EXCEPTION_TRACING
@@ -0,0 +1,281 @@
+// --- Internal Includes ---
+#include "cieutils/packages/output/inc/MappedFile.hpp"
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <cstring>
+#include <cerrno>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CIE_POSIX_MAPPED_FILES
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+namespace cie::utils {
+
+
+namespace {
+std::string systemError( const std::string& r_what, const std::filesystem::path& r_path )
+{
+    return r_what + " " + r_path.string() + ": " + std::strerror(errno);
+}
+} // anonymous namespace
+
+
+MappedFile::MappedFile( const std::filesystem::path& r_filePath,
+                        MappedFile::Mode mode ) :
+    _path( r_filePath ),
+    _mode( mode ),
+    _fileDescriptor( -1 ),
+    _p_data( nullptr ),
+    _size( 0 )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    #ifdef CIE_POSIX_MAPPED_FILES
+    _fileDescriptor = ::open( _path.c_str(), mode == Mode::Read ? O_RDONLY : O_RDWR );
+    if ( _fileDescriptor < 0 )
+        CIE_THROW( Exception, systemError("Failed to open", _path) )
+
+    // The destructor doesn't run if the constructor throws
+    try
+    {
+        struct stat status;
+        if ( ::fstat(_fileDescriptor, &status) != 0 )
+            CIE_THROW( Exception, systemError("Failed to get the size of", _path) )
+
+        _size = status.st_size;
+        this->map();
+    }
+    catch ( ... )
+    {
+        this->unmap();
+        this->close();
+        throw;
+    }
+    #else
+    CIE_THROW( Exception, "Memory mapped files are not supported on this platform" )
+    #endif
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+MappedFile::MappedFile( const std::filesystem::path& r_filePath,
+                        Size size ) :
+    _path( r_filePath ),
+    _mode( Mode::ReadWrite ),
+    _fileDescriptor( -1 ),
+    _p_data( nullptr ),
+    _size( 0 )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    #ifdef CIE_POSIX_MAPPED_FILES
+    _fileDescriptor = ::open( _path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    if ( _fileDescriptor < 0 )
+        CIE_THROW( Exception, systemError("Failed to create", _path) )
+
+    // The destructor doesn't run if the constructor throws
+    try
+    {
+        this->resize( size );
+    }
+    catch ( ... )
+    {
+        this->unmap();
+        this->close();
+        throw;
+    }
+    #else
+    CIE_THROW( Exception, "Memory mapped files are not supported on this platform" )
+    #endif
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+MappedFile::MappedFile( MappedFile&& r_rhs ) :
+    _path( std::move(r_rhs._path) ),
+    _mode( r_rhs._mode ),
+    _fileDescriptor( std::exchange(r_rhs._fileDescriptor, -1) ),
+    _p_data( std::exchange(r_rhs._p_data, nullptr) ),
+    _size( std::exchange(r_rhs._size, 0) )
+{
+}
+
+
+MappedFile& MappedFile::operator=( MappedFile&& r_rhs )
+{
+    if ( this != &r_rhs )
+    {
+        this->unmap();
+        this->close();
+
+        _path           = std::move( r_rhs._path );
+        _mode           = r_rhs._mode;
+        _fileDescriptor = std::exchange( r_rhs._fileDescriptor, -1 );
+        _p_data         = std::exchange( r_rhs._p_data, nullptr );
+        _size           = std::exchange( r_rhs._size, 0 );
+    }
+
+    return *this;
+}
+
+
+MappedFile::~MappedFile()
+{
+    this->unmap();
+    this->close();
+}
+
+
+void MappedFile::resize( Size size )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( !this->writable() )
+        CIE_THROW( Exception, "Cannot resize read-only mapped file " + _path.string() )
+
+    #ifdef CIE_POSIX_MAPPED_FILES
+    this->unmap();
+
+    try
+    {
+        if ( ::ftruncate(_fileDescriptor, size) != 0 )
+            CIE_THROW( Exception, systemError("Failed to resize", _path) )
+
+        // Reserve the blocks up front, so that writing through the mapping
+        // doesn't fail (SIGBUS) on a full disk
+        #ifdef __linux__
+        if ( _size < size )
+        {
+            const int error = ::posix_fallocate( _fileDescriptor, _size, size - _size );
+            if ( error != 0 && error != EOPNOTSUPP && error != EINVAL )
+            {
+                errno = error;
+                CIE_THROW( Exception, systemError("Failed to allocate", _path) )
+            }
+        }
+        #endif
+    }
+    catch ( ... )
+    {
+        // Map whatever size the file has now, so that the size and the data stay consistent
+        struct stat status;
+        _size = ::fstat( _fileDescriptor, &status ) == 0 ? status.st_size : 0;
+
+        try
+        {
+            this->map();
+        }
+        catch ( ... )
+        {
+            _size = 0;
+        }
+
+        throw;
+    }
+
+    _size = size;
+    this->map();
+    #endif
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void MappedFile::sync( bool blocking )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    #ifdef CIE_POSIX_MAPPED_FILES
+    if ( _p_data && this->writable() )
+        if ( ::msync(_p_data, _size, blocking ? MS_SYNC : MS_ASYNC) != 0 )
+            CIE_THROW( Exception, systemError("Failed to sync", _path) )
+    #endif
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void* MappedFile::data()
+{
+    return _p_data;
+}
+
+
+const void* MappedFile::data() const
+{
+    return _p_data;
+}
+
+
+Size MappedFile::size() const
+{
+    return _size;
+}
+
+
+bool MappedFile::writable() const
+{
+    return _mode == Mode::ReadWrite;
+}
+
+
+const std::filesystem::path& MappedFile::path() const
+{
+    return _path;
+}
+
+
+void MappedFile::map()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    #ifdef CIE_POSIX_MAPPED_FILES
+    // Empty files can't be mapped
+    if ( _size == 0 )
+        return;
+
+    const int protection = this->writable() ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* p_data = ::mmap( nullptr, _size, protection, MAP_SHARED, _fileDescriptor, 0 );
+
+    if ( p_data == MAP_FAILED )
+        CIE_THROW( Exception, systemError("Failed to map", _path) )
+
+    _p_data = p_data;
+    #endif
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void MappedFile::unmap()
+{
+    #ifdef CIE_POSIX_MAPPED_FILES
+    if ( _p_data )
+        ::munmap( _p_data, _size );
+    #endif
+
+    _p_data = nullptr;
+}
+
+
+void MappedFile::close()
+{
+    #ifdef CIE_POSIX_MAPPED_FILES
+    if ( 0 <= _fileDescriptor )
+        ::close( _fileDescriptor );
+    #endif
+
+    _fileDescriptor = -1;
+}
+
+
+} // namespace cie::utils
\ No newline at end of file
@@ -0,0 +1,123 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/output/inc/FileManager.hpp"
+#include "cieutils/packages/output/inc/MappedFile.hpp"
+#include "cmake_variables.hpp"
+
+// --- STL Includes ---
+#include <numeric>
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+
+
+namespace cie::utils {
+
+
+CIE_TEST_CASE( "MappedFile", "[output]" )
+{
+    CIE_TEST_CASE_INIT( "MappedFile" )
+
+    FileManager manager( TEST_OUTPUT_PATH / "test" );
+    const std::filesystem::path fileName = "mappedArray.bin";
+
+    {
+        CIE_TEST_CASE_INIT( "write" )
+
+        MappedArray<double> array = manager.newMappedArray<double>( fileName, 100 );
+
+        CIE_TEST_REQUIRE( array.size() == 100 );
+        CIE_TEST_CHECK( array.file()->size() == 100 * sizeof(double) );
+        CIE_TEST_CHECK( array.file()->writable() );
+
+        std::iota( array.begin(), array.end(), 0.0 );
+        CIE_TEST_CHECK_NOTHROW( array.sync() );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "read" )
+
+        CIE_TEST_CHECK_THROWS( manager.openMappedFile( "nonExistentFile.bin" ) );
+
+        // Open as raw bytes
+        MappedFilePtr p_file;
+        CIE_TEST_REQUIRE_NOTHROW( p_file = manager.openMappedFile( fileName ) );
+        CIE_TEST_CHECK( p_file->size() == 100 * sizeof(double) );
+        CIE_TEST_CHECK( !p_file->writable() );
+        CIE_TEST_CHECK_THROWS( p_file->resize( 0 ) );
+
+        // Sizes must be compatible with the value type
+        CIE_TEST_CHECK_THROWS( MappedArray<char[3]>( p_file ) );
+
+        const MappedArray<double> array( p_file );
+        CIE_TEST_REQUIRE( array.size() == 100 );
+        for ( Size i=0; i<array.size(); ++i )
+            CIE_TEST_CHECK( array[i] == double(i) );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "resize" )
+
+        auto array = manager.openMappedArray<double>( fileName, MappedFile::Mode::ReadWrite );
+        CIE_TEST_REQUIRE( array.size() == 100 );
+
+        // Grow
+        CIE_TEST_REQUIRE_NOTHROW( array.resize( 200 ) );
+        CIE_TEST_REQUIRE( array.size() == 200 );
+        for ( Size i=0; i<100; ++i )
+            CIE_TEST_CHECK( array[i] == double(i) );
+
+        std::fill( array.begin() + 100, array.end(), -1.0 );
+
+        // Shrink
+        CIE_TEST_REQUIRE_NOTHROW( array.resize( 150 ) );
+        CIE_TEST_CHECK( array.size() == 150 );
+        CIE_TEST_CHECK( array[99] == 99.0 );
+        CIE_TEST_CHECK( array[149] == -1.0 );
+
+        // Empty
+        CIE_TEST_REQUIRE_NOTHROW( array.resize( 0 ) );
+        CIE_TEST_CHECK( array.empty() );
+        CIE_TEST_CHECK( array.data() == nullptr );
+        CIE_TEST_CHECK( array.begin() == array.end() );
+        CIE_TEST_CHECK_NOTHROW( array.sync() );
+    }
+
+    #ifdef __linux__
+    {
+        CIE_TEST_CASE_INIT( "failed construction" )
+
+        auto countFileDescriptors = []() -> Size
+        {
+            return std::distance( std::filesystem::directory_iterator("/proc/self/fd"),
+                                  std::filesystem::directory_iterator() );
+        };
+
+        // Resizing to an invalid size fails after the file was opened
+        const Size numberOfFileDescriptors = countFileDescriptors();
+        for ( Size i=0; i<10; ++i )
+            CIE_TEST_CHECK_THROWS( MappedFile(TEST_OUTPUT_PATH / "test" / fileName, Size(-1)) );
+
+        CIE_TEST_CHECK( countFileDescriptors() == numberOfFileDescriptors );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "failed resize" )
+
+        auto array = manager.newMappedArray<double>( fileName, 10 );
+        std::iota( array.begin(), array.end(), 0.0 );
+
+        // The file keeps its size and stays mapped
+        CIE_TEST_CHECK_THROWS( array.file()->resize( Size(-1) ) );
+        CIE_TEST_REQUIRE( array.size() == 10 );
+        CIE_TEST_REQUIRE( array.data() != nullptr );
+        for ( Size i=0; i<array.size(); ++i )
+            CIE_TEST_CHECK( array[i] == double(i) );
+    }
+    #endif
+
+    manager.deleteFile( fileName );
+}
+
+
+} // namespace cie::utils
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef CIE_UTILS_STL_EXTENSION_HASH_HPP
+#define CIE_UTILS_STL_EXTENSION_HASH_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/concepts/inc/container_concepts.hpp"
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <functional>
+#include <type_traits>
+#include <cmath>
+
+
+namespace cie::utils {
+
+
+/// Spread the bits of a hash (finalizer of splitmix64), so that similar inputs give dissimilar hashes
+inline Size scrambleHash( Size hash )
+{
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    return hash ^ (hash >> 31);
+}
+
+
+/// Mix the hash of 'r_value' into 'r_seed'
+template <class ValueType>
+inline void hashCombine( Size& r_seed, const ValueType& r_value )
+{
+    r_seed ^= std::hash<ValueType>()( r_value ) + 0x9e3779b97f4a7c15 + (r_seed << 6) + (r_seed >> 2);
+}
+
+
+/**
+ * @brief Hash containers by their contents (eg.: as key for unordered maps).
+ * Nested containers (eg.: point sets) are hashed recursively, so equal
+ * contents give equal hashes regardless of where they are stored.
+ */
+struct ContainerHash
+{
+    template <class ValueType>
+    Size operator()( const ValueType& r_value ) const
+    {
+        if constexpr ( concepts::STLContainer<ValueType> )
+        {
+            Size seed = r_value.size();
+            for ( const auto& r_item : r_value )
+                hashCombine( seed, scrambleHash(this->operator()(r_item)) );
+            return seed;
+        }
+        else
+            return std::hash<ValueType>()( r_value );
+    }
+};
+
+
+/**
+ * @brief Content hash that rounds floating point items to a grid of the specified resolution.
+ * Useful for matching point sets that went through slightly different arithmetic.
+ * @note values close to a grid boundary can still be rounded to different grid points.
+ */
+class QuantizedContainerHash
+{
+public:
+    QuantizedContainerHash( double resolution = 1e-12 )
+        : _inverseResolution( 1.0 / resolution )
+    {}
+
+    template <class ValueType>
+    Size operator()( const ValueType& r_value ) const
+    {
+        if constexpr ( concepts::STLContainer<ValueType> )
+        {
+            Size seed = r_value.size();
+            for ( const auto& r_item : r_value )
+                hashCombine( seed, scrambleHash(this->operator()(r_item)) );
+            return seed;
+        }
+        else if constexpr ( std::is_floating_point_v<ValueType> )
+            return std::hash<long long>()( std::llround(r_value * _inverseResolution) );
+        else
+            return std::hash<ValueType>()( r_value );
+    }
+
+    double resolution() const
+    { return 1.0 / _inverseResolution; }
+
+private:
+    double _inverseResolution;
+};
+
+
+} // namespace cie::utils
+
+
+#endif
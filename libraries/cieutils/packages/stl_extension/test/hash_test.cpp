@@ -0,0 +1,57 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/stl_extension/inc/hash.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <array>
+#include <unordered_set>
+
+
+namespace cie::utils {
+
+
+CIE_TEST_CASE( "ContainerHash", "[stl_extension]" )
+{
+    CIE_TEST_CASE_INIT( "ContainerHash" )
+
+    ContainerHash hash;
+
+    CIE_TEST_CHECK( hash(std::vector<int> {1,2,3}) == hash(std::vector<int> {1,2,3}) );
+    CIE_TEST_CHECK( hash(std::vector<int> {1,2,3}) != hash(std::vector<int> {3,2,1}) );
+    CIE_TEST_CHECK( hash(std::vector<int> {}) != hash(std::vector<int> {0}) );
+    CIE_TEST_CHECK( hash(std::array<double,2> {0.0, 1.0}) == hash(std::array<double,2> {-0.0, 1.0}) );
+
+    std::unordered_set<std::array<int,2>,ContainerHash> set;
+    for ( int i=0; i<10; ++i )
+        for ( int j=0; j<10; ++j )
+            set.insert( {i, j} );
+
+    CIE_TEST_CHECK( set.size() == 100 );
+
+    // Nested containers
+    using PointSet = std::vector<std::array<double,2>>;
+    CIE_TEST_CHECK( hash(PointSet {{0.0, 1.0}, {2.0, 3.0}}) == hash(PointSet {{0.0, 1.0}, {2.0, 3.0}}) );
+    CIE_TEST_CHECK( hash(PointSet {{0.0, 1.0}, {2.0, 3.0}}) != hash(PointSet {{2.0, 3.0}, {0.0, 1.0}}) );
+    CIE_TEST_CHECK( hash(PointSet {{0.0, 1.0}, {2.0, 3.0}}) != hash(PointSet {{0.0, 1.0}, {2.0, 3.5}}) );
+}
+
+
+CIE_TEST_CASE( "QuantizedContainerHash", "[stl_extension]" )
+{
+    CIE_TEST_CASE_INIT( "QuantizedContainerHash" )
+
+    QuantizedContainerHash hash( 1e-6 );
+    CIE_TEST_CHECK( hash.resolution() == Approx(1e-6) );
+
+    const double third = 1.0 / 3.0;
+    const double alsoThird = 1.0 - 2.0 / 3.0;
+
+    using PointSet = std::vector<std::array<double,2>>;
+    CIE_TEST_CHECK( hash(PointSet {{third, 0.0}}) == hash(PointSet {{alsoThird + 1e-9, -0.0}}) );
+    CIE_TEST_CHECK( hash(PointSet {{third, 0.0}}) != hash(PointSet {{third + 1e-5, 0.0}}) );
+    CIE_TEST_CHECK( hash(std::vector<int> {1,2}) == ContainerHash()(std::vector<int> {1,2}) );
+}
+
+
+} // namespace cie::utils
@@ -0,0 +1,336 @@
+#ifndef CIE_CIEUTILS_FLAT_TREE_IMPL_HPP
+#define CIE_CIEUTILS_FLAT_TREE_IMPL_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+#include "cieutils/packages/macros/inc/checks.hpp"
+
+// --- STL Includes ---
+#include <utility>
+
+namespace cie::utils {
+
+
+template <class ValueType, class IndexType>
+FlatTree<ValueType,IndexType>::FlatTree()
+{
+}
+
+
+template <class ValueType, class IndexType>
+FlatTree<ValueType,IndexType>::FlatTree( const ValueType& r_rootValue )
+{
+    this->makeRoot( r_rootValue );
+}
+
+
+template <class ValueType, class IndexType>
+IndexType
+FlatTree<ValueType,IndexType>::makeRoot( const ValueType& r_value )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK( this->empty(), "The tree already has a root" )
+
+    _nodes.push_back( Node { npos, npos, 0, 0 } );
+    _values.push_back( r_value );
+
+    return 0;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType, class IndexType>
+inline IndexType
+FlatTree<ValueType,IndexType>::root() const
+{
+    CIE_OUT_OF_RANGE_CHECK( !this->empty() )
+    return 0;
+}
+
+
+template <class ValueType, class IndexType>
+IndexType
+FlatTree<ValueType,IndexType>::split( IndexType index,
+                                      Size numberOfChildren,
+                                      const ValueType& r_value )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    CIE_CHECK( this->isLeaf(index), "Only leaf nodes can be split" )
+    CIE_CHECK(
+        this->size() + numberOfChildren < Size(npos),
+        "Number of nodes exceeds the index range"
+    )
+
+    const IndexType firstChild = IndexType( this->size() );
+    const IndexType level      = _nodes[index].level + 1;
+
+    _nodes.resize( _nodes.size() + numberOfChildren, Node { index, npos, 0, level } );
+    _values.resize( _values.size() + numberOfChildren, r_value );
+
+    if ( numberOfChildren )
+    {
+        _nodes[index].firstChild       = firstChild;
+        _nodes[index].numberOfChildren = IndexType( numberOfChildren );
+    }
+
+    return firstChild;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType, class IndexType>
+inline ValueType&
+FlatTree<ValueType,IndexType>::operator[]( IndexType index )
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _values[index];
+}
+
+
+template <class ValueType, class IndexType>
+inline const ValueType&
+FlatTree<ValueType,IndexType>::operator[]( IndexType index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _values[index];
+}
+
+
+template <class ValueType, class IndexType>
+inline IndexType
+FlatTree<ValueType,IndexType>::parent( IndexType index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _nodes[index].parent;
+}
+
+
+template <class ValueType, class IndexType>
+inline IndexType
+FlatTree<ValueType,IndexType>::child( IndexType index,
+                                      Size childIndex ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    CIE_OUT_OF_RANGE_CHECK( childIndex < _nodes[index].numberOfChildren )
+    return _nodes[index].firstChild + IndexType( childIndex );
+}
+
+
+template <class ValueType, class IndexType>
+inline IndexType
+FlatTree<ValueType,IndexType>::firstChild( IndexType index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _nodes[index].firstChild;
+}
+
+
+template <class ValueType, class IndexType>
+inline Size
+FlatTree<ValueType,IndexType>::numberOfChildren( IndexType index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _nodes[index].numberOfChildren;
+}
+
+
+template <class ValueType, class IndexType>
+inline bool
+FlatTree<ValueType,IndexType>::isLeaf( IndexType index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _nodes[index].numberOfChildren == 0;
+}
+
+
+template <class ValueType, class IndexType>
+inline Size
+FlatTree<ValueType,IndexType>::level( IndexType index ) const
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+    return _nodes[index].level;
+}
+
+
+template <class ValueType, class IndexType>
+template <class FunctionType>
+bool
+FlatTree<ValueType,IndexType>::visit( FunctionType&& r_function,
+                                      IndexType index )
+{
+    CIE_OUT_OF_RANGE_CHECK( index < this->size() )
+
+    // Walk the tree using the parent indices and the contiguity
+    // of siblings, so no stack is required
+    IndexType current = index;
+
+    while ( true )
+    {
+        if ( !r_function(current) )
+            return false;
+
+        if ( _nodes[current].numberOfChildren )
+        {
+            current = _nodes[current].firstChild;
+            continue;
+        }
+
+        // Find the next sibling of the closest ancestor that has one
+        while ( true )
+        {
+            if ( current == index )
+                return true;
+
+            const Node& r_parent = _nodes[_nodes[current].parent];
+
+            if ( current + 1 < r_parent.firstChild + r_parent.numberOfChildren )
+            {
+                ++current;
+                break;
+            }
+
+            current = _nodes[current].parent;
+        }
+    }
+}
+
+
+template <class ValueType, class IndexType>
+void
+FlatTree<ValueType,IndexType>::reorder( Ordering ordering )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if ( this->empty() )
+        return;
+
+    // Assign new indices to sibling blocks in the requested order
+    std::vector<IndexType> newIndices( this->size() );
+    std::vector<IndexType> pending;
+    pending.reserve( ordering == Ordering::BreadthFirst ? this->size() : 64 );
+
+    newIndices[0] = 0;
+    IndexType counter = 1;
+    pending.push_back( 0 );
+
+    if ( ordering == Ordering::BreadthFirst )
+    {
+        // 'pending' is a queue
+        for ( Size i=0; i<pending.size(); ++i )
+        {
+            const Node& r_node = _nodes[pending[i]];
+            for ( IndexType i_child=0; i_child<r_node.numberOfChildren; ++i_child )
+            {
+                newIndices[r_node.firstChild + i_child] = counter++;
+                pending.push_back( r_node.firstChild + i_child );
+            }
+        }
+    }
+    else
+    {
+        // 'pending' is a stack
+        while ( !pending.empty() )
+        {
+            const Node& r_node = _nodes[pending.back()];
+            pending.pop_back();
+
+            for ( IndexType i_child=0; i_child<r_node.numberOfChildren; ++i_child )
+                newIndices[r_node.firstChild + i_child] = counter++;
+
+            for ( IndexType i_child=r_node.numberOfChildren; 0<i_child; --i_child )
+                pending.push_back( r_node.firstChild + i_child - 1 );
+        }
+    }
+
+    // Permute the nodes
+    std::vector<Node> nodes( this->size() );
+    std::vector<ValueType> values;
+    values.reserve( this->size() );
+
+    for ( Size i=0; i<this->size(); ++i )
+    {
+        const Node& r_node = _nodes[i];
+        nodes[newIndices[i]] = Node {
+            r_node.parent == npos ? npos : newIndices[r_node.parent],
+            r_node.numberOfChildren ? newIndices[r_node.firstChild] : npos,
+            r_node.numberOfChildren,
+            r_node.level
+        };
+    }
+
+    std::vector<IndexType> oldIndices( this->size() );
+    for ( Size i=0; i<this->size(); ++i )
+        oldIndices[newIndices[i]] = IndexType( i );
+
+    for ( auto oldIndex : oldIndices )
+        values.push_back( std::move(_values[oldIndex]) );
+
+    _nodes  = std::move( nodes );
+    _values = std::move( values );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType, class IndexType>
+inline void
+FlatTree<ValueType,IndexType>::reserve( Size capacity )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    _nodes.reserve( capacity );
+    _values.reserve( capacity );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class ValueType, class IndexType>
+inline void
+FlatTree<ValueType,IndexType>::clear()
+{
+    _nodes.clear();
+    _values.clear();
+}
+
+
+template <class ValueType, class IndexType>
+inline Size
+FlatTree<ValueType,IndexType>::size() const
+{
+    return _nodes.size();
+}
+
+
+template <class ValueType, class IndexType>
+inline bool
+FlatTree<ValueType,IndexType>::empty() const
+{
+    return _nodes.empty();
+}
+
+
+template <class ValueType, class IndexType>
+inline const std::vector<ValueType>&
+FlatTree<ValueType,IndexType>::values() const
+{
+    return _values;
+}
+
+
+template <class ValueType, class IndexType>
+inline std::vector<ValueType>&
+FlatTree<ValueType,IndexType>::values()
+{
+    return _values;
+}
+
+
+} // namespace cie::utils
+
+#endif
\ No newline at end of file
@@ -1,6 +1,15 @@
 #ifndef CIE_CIEUTILS_ABS_TREE_IMPL_HPP
 #define CIE_CIEUTILS_ABS_TREE_IMPL_HPP
 
+// --- Internal Includes ---
+#include "cieutils/packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <utility>
+
 namespace cie::utils {
 
 
@@ -59,20 +68,134 @@ AbsTree<ContainerType,SelfType,Args...>::level() const
 
 
 template <template <class ...> class ContainerType, class SelfType, class ...Args>
+template <class FunctionType>
+inline bool
+AbsTree<ContainerType,SelfType,Args...>::visit( FunctionType&& r_function )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::vector<SelfType*> stack;
+    stack.reserve( 64 );
+    stack.push_back( static_cast<SelfType*>(this) );
+
+    while ( !stack.empty() )
+    {
+        SelfType* p_node = stack.back();
+        stack.pop_back();
+
+        if ( !r_function(p_node) )
+            return false;
+
+        // Push in reverse to visit the children in order
+        const auto& r_children = p_node->children();
+        for ( auto it_child=r_children.rbegin(); it_child!=r_children.rend(); ++it_child )
+            if ( *it_child )
+                stack.push_back( it_child->get() );
+    }
+
+    return true;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <template <class ...> class ContainerType, class SelfType, class ...Args>
+template <class FunctionType>
+inline bool
+AbsTree<ContainerType,SelfType,Args...>::visitBreadthFirst( FunctionType&& r_function )
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::deque<SelfType*> queue;
+    queue.push_back( static_cast<SelfType*>(this) );
+
+    while ( !queue.empty() )
+    {
+        SelfType* p_node = queue.front();
+        queue.pop_front();
+
+        if ( !r_function(p_node) )
+            return false;
+
+        for ( const auto& rp_child : p_node->children() )
+            if ( rp_child )
+                queue.push_back( rp_child.get() );
+    }
+
+    return true;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <template <class ...> class ContainerType, class SelfType, class ...Args>
+template <class FunctionType>
 inline bool
-AbsTree<ContainerType,SelfType,Args...>::visit( NodeVisitFunction<SelfType> function )
+AbsTree<ContainerType,SelfType,Args...>::visitParallel( FunctionType&& r_function,
+                                                        mp::ThreadPool& r_pool,
+                                                        Size taskDepth )
 {
-    bool result = function( dynamic_cast<SelfType*>(this) );
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    std::atomic<bool> result = true;
+    std::vector<mp::JobHandle<void>> handles;
+
+    // Visit the top of the tree on this thread and collect the subtrees
+    std::vector<std::pair<SelfType*,Size>> stack;
+    stack.emplace_back( static_cast<SelfType*>(this), 0 );
 
-    if (result)
-        for (auto& child : this->_children)
+    try
+    {
+        while ( !stack.empty() )
         {
-            result = child->visit(function);
-            if (!result)
+            auto [p_node, depth] = stack.back();
+            stack.pop_back();
+
+            if ( depth == taskDepth )
+            {
+                // The function and the flag outlive the job, it is waited for below
+                handles.push_back( r_pool.submit(
+                    [p_node, &r_function, &result]() -> void
+                    {
+                        auto function = [&r_function, &result]( SelfType* p_visited ) -> bool
+                        { return result.load(std::memory_order_relaxed) && r_function(p_visited); };
+
+                        if ( !p_node->visit(function) )
+                            result = false;
+                    }
+                ) );
+                continue;
+            }
+
+            if ( !r_function(p_node) )
+            {
+                result = false;
                 break;
+            }
+
+            const auto& r_children = p_node->children();
+            for ( auto it_child=r_children.rbegin(); it_child!=r_children.rend(); ++it_child )
+                if ( *it_child )
+                    stack.emplace_back( it_child->get(), depth + 1 );
         }
-    
+    }
+    catch ( ... )
+    {
+        // Submitted jobs refer to the function and the flag:
+        // stop them and wait for them before unwinding
+        result = false;
+        r_pool.waitFor( handles );
+        throw;
+    }
+
+    r_pool.waitFor( handles );
+
+    for ( const auto& r_handle : handles )
+        r_handle.get();
+
     return result;
+
+    CIE_END_EXCEPTION_TRACING
 }
 
 
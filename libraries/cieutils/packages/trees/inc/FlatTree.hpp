@@ -0,0 +1,130 @@
+#ifndef CIE_CIEUTILS_FLAT_TREE_HPP
+#define CIE_CIEUTILS_FLAT_TREE_HPP
+
+// --- Internal Includes ---
+#include "cieutils/packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+namespace cie::utils {
+
+
+/**
+ * Tree with contiguous storage: an alternative to AbsTree for large trees.
+ *
+ * Nodes are stored in an arena (one array for the topology, one for the values)
+ * and are referred to by index instead of pointers. The children of a node are
+ * created together (split) and occupy a contiguous block of indices, so no per-node
+ * allocations or reference counting take place.
+ *
+ * Nodes are appended in creation order, and can be reordered in breadth-first or
+ * depth-first order for cache-friendly traversals. Siblings always stay contiguous,
+ * so the depth-first order arranges whole sibling blocks in the order their parents
+ * are reached (not a strict pre-order of the nodes). Only if all leaves are on the
+ * same level and children are created in Cartesian (bit-interleaved) order are the
+ * leaves in Morton order.
+ *
+ * @note indices are invalidated by reorder and clear, references to values are
+ * invalidated by split as well.
+ */
+template <class ValueType, class IndexType = std::uint32_t>
+class FlatTree
+{
+public:
+    using value_type    = ValueType;
+    using index_type    = IndexType;
+    using size_type     = Size;
+
+    /// Index of nonexistent nodes (parent of the root, first child of leaves)
+    static constexpr IndexType npos = std::numeric_limits<IndexType>::max();
+
+    enum class Ordering
+    {
+        BreadthFirst,
+        DepthFirst
+    };
+
+public:
+    /// Empty tree
+    FlatTree();
+
+    /// Tree with a root
+    FlatTree( const ValueType& r_rootValue );
+
+    /// Create a root in an empty tree and return its index
+    IndexType makeRoot( const ValueType& r_value = ValueType() );
+
+    IndexType root() const;
+
+    /**
+     * Create children for a leaf node.
+     * @return index of the first child (the rest follow contiguously)
+     */
+    IndexType split( IndexType index,
+                     Size numberOfChildren,
+                     const ValueType& r_value = ValueType() );
+
+    ValueType& operator[]( IndexType index );
+    const ValueType& operator[]( IndexType index ) const;
+
+    IndexType parent( IndexType index ) const;
+
+    IndexType child( IndexType index,
+                     Size childIndex ) const;
+
+    /// Index of the first child (npos for leaves)
+    IndexType firstChild( IndexType index ) const;
+
+    Size numberOfChildren( IndexType index ) const;
+
+    bool isLeaf( IndexType index ) const;
+
+    Size level( IndexType index ) const;
+
+    /**
+     * Execute a function on the nodes of a subtree (depth-first) while it returns true.
+     * @param r_function bool(IndexType) - may split the node it is called on
+     */
+    template <class FunctionType>
+    bool visit( FunctionType&& r_function,
+                IndexType index = 0 );
+
+    /// Rearrange sibling blocks in the specified order (invalidates indices)
+    void reorder( Ordering ordering );
+
+    void reserve( Size capacity );
+
+    void clear();
+
+    /// Number of nodes
+    Size size() const;
+
+    bool empty() const;
+
+    /// Node values in storage order
+    const std::vector<ValueType>& values() const;
+    std::vector<ValueType>& values();
+
+private:
+    struct Node
+    {
+        IndexType parent;
+        IndexType firstChild;
+        IndexType numberOfChildren;
+        IndexType level;
+    };
+
+private:
+    std::vector<Node>       _nodes;
+    std::vector<ValueType>  _values;
+};
+
+
+} // namespace cie::utils
+
+#include "cieutils/packages/trees/impl/FlatTree_impl.hpp"
+
+#endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 // --- Internal Includes ---
 #include "cieutils/packages/types/inc/types.hpp"
+#include "cieutils/packages/concurrency/inc/ThreadPool.hpp"
 
 // --- STL Includes ---
 #include <functional>
@@ -11,7 +12,7 @@
 namespace cie::utils {
 
 
-// Define visitor function
+// Type-erased visitor function (visit accepts any callable with this signature)
 template <class NodeType>
 using NodeVisitFunction = std::function<bool( NodeType* node )>;
 
@@ -38,8 +39,30 @@ public:
 
     Size level() const;
 
-    // Send a function down the tree and execute it on all nodes while it returns true
-    virtual bool visit( NodeVisitFunction<SelfType> function );
+    /**
+     * Send a function down the tree and execute it on all nodes while it returns true
+     * (depth-first, each node before its children).
+     * @param r_function bool(SelfType*) - may modify the children of the node it is called on
+     * @note the traversal is iterative, so the depth of the tree is not limited by the call stack
+     */
+    template <class FunctionType>
+    bool visit( FunctionType&& r_function );
+
+    /// Execute a function on all nodes level by level while it returns true
+    template <class FunctionType>
+    bool visitBreadthFirst( FunctionType&& r_function );
+
+    /**
+     * Execute a function on all nodes while it returns true, traversing subtrees in parallel.
+     * Nodes up to 'taskDepth' levels below this one are visited on the calling thread, then
+     * the subtrees rooted at that depth are traversed (depth-first) in separate jobs.
+     * @note the function must be thread-safe. If it returns false, the remaining jobs
+     * stop as soon as possible.
+     */
+    template <class FunctionType>
+    bool visitParallel( FunctionType&& r_function,
+                        mp::ThreadPool& r_pool,
+                        Size taskDepth = 2 );
 
     /**
      * Check whether this node is a leaf node
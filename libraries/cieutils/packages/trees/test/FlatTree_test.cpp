@@ -0,0 +1,176 @@
+// --- Internal Includes ---
+#include "cieutils/packages/testing/inc/essentials.hpp"
+#include "cieutils/packages/trees/inc/FlatTree.hpp"
+
+// --- STL Includes ---
+#include <string>
+
+namespace cie::utils {
+
+
+CIE_TEST_CASE( "FlatTree", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "FlatTree" )
+
+    // Nodes store their path from the root ("" -> "0","1" -> "00","01","10","11" ...)
+    using TreeType = FlatTree<std::string>;
+    TreeType tree;
+
+    CIE_TEST_CHECK( tree.empty() );
+    CIE_TEST_REQUIRE_NOTHROW( tree.makeRoot("") );
+    CIE_TEST_CHECK_THROWS( tree.makeRoot("") );
+    CIE_TEST_REQUIRE( tree.size() == 1 );
+    CIE_TEST_CHECK( tree.isLeaf(tree.root()) );
+    CIE_TEST_CHECK( tree.parent(tree.root()) == TreeType::npos );
+    CIE_TEST_CHECK( tree.firstChild(tree.root()) == TreeType::npos );
+
+    // Split nodes in two until the target depth is reached (also splits new children)
+    const Size depth = 6;
+    Size counter = 0;
+    auto split = [&tree, &counter, depth]( TreeType::index_type index ) -> bool
+    {
+        ++counter;
+        if ( tree.level(index) < depth )
+        {
+            const auto firstChild = tree.split( index, 2 );
+            tree[firstChild]     = tree[index] + "0";
+            tree[firstChild + 1] = tree[index] + "1";
+        }
+        return true;
+    };
+
+    CIE_TEST_REQUIRE( tree.visit(split) );
+
+    const Size numberOfNodes = (1 << (depth+1)) - 1;
+    CIE_TEST_CHECK( counter == numberOfNodes );
+    CIE_TEST_REQUIRE( tree.size() == numberOfNodes );
+    CIE_TEST_CHECK_THROWS( tree.split(tree.root(), 2) );
+
+    auto checkTopology = [&tree, depth]() -> void
+    {
+        CIE_TEST_CHECK( tree[tree.root()] == "" );
+
+        for ( TreeType::index_type i=0; i<tree.size(); ++i )
+        {
+            const auto& r_path = tree[i];
+            CIE_TEST_CHECK( tree.level(i) == r_path.size() );
+            CIE_TEST_CHECK( tree.isLeaf(i) == (r_path.size() == depth) );
+
+            if ( i != tree.root() )
+            {
+                CIE_TEST_REQUIRE( tree.parent(i) < tree.size() );
+                CIE_TEST_CHECK( tree[tree.parent(i)] == r_path.substr(0, r_path.size()-1) );
+            }
+
+            for ( Size i_child=0; i_child<tree.numberOfChildren(i); ++i_child )
+            {
+                CIE_TEST_CHECK( tree.parent(tree.child(i, i_child)) == i );
+                CIE_TEST_CHECK( tree[tree.child(i, i_child)] == r_path + std::to_string(i_child) );
+            }
+        }
+    };
+
+    {
+        CIE_TEST_CASE_INIT( "creation order" )
+        checkTopology();
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "breadth first" )
+
+        CIE_TEST_REQUIRE_NOTHROW( tree.reorder(TreeType::Ordering::BreadthFirst) );
+        CIE_TEST_REQUIRE( tree.size() == numberOfNodes );
+        checkTopology();
+
+        for ( TreeType::index_type i=1; i<tree.size(); ++i )
+        {
+            CIE_TEST_CHECK( tree.level(i-1) <= tree.level(i) );
+            if ( tree.level(i-1) == tree.level(i) )
+                CIE_TEST_CHECK( tree[i-1] < tree[i] );
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "depth first" )
+
+        CIE_TEST_REQUIRE_NOTHROW( tree.reorder(TreeType::Ordering::DepthFirst) );
+        CIE_TEST_REQUIRE( tree.size() == numberOfNodes );
+        checkTopology();
+
+        // All leaves are on the same level => they are in lexicographic (Morton) order
+        std::string previous;
+        for ( TreeType::index_type i=0; i<tree.size(); ++i )
+            if ( tree.isLeaf(i) )
+            {
+                CIE_TEST_CHECK( previous < tree[i] );
+                previous = tree[i];
+            }
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "visit" )
+
+        // Visit a subtree in depth first order
+        std::vector<std::string> visited;
+        const auto subtree = tree.child( tree.root(), 1 );
+
+        CIE_TEST_CHECK( tree.visit(
+            [&tree, &visited]( TreeType::index_type index ) -> bool
+            {
+                visited.push_back( tree[index] );
+                return true;
+            },
+            subtree
+        ) );
+
+        CIE_TEST_REQUIRE( visited.size() == (numberOfNodes - 1) / 2 );
+        CIE_TEST_CHECK( visited.front() == "1" );
+        for ( Size i=1; i<visited.size(); ++i )
+        {
+            CIE_TEST_CHECK( visited[i-1] < visited[i] );
+            CIE_TEST_CHECK( visited[i].front() == '1' );
+        }
+
+        // Stop early
+        counter = 0;
+        CIE_TEST_CHECK( !tree.visit(
+            [&counter]( TreeType::index_type ) -> bool { return ++counter < 10; }
+        ) );
+        CIE_TEST_CHECK( counter == 10 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "depth first (uneven)" )
+
+        // Sibling blocks are kept together, so the leaves of an uneven tree
+        // are not in Morton order ("01" precedes "000")
+        TreeType uneven( "" );
+        auto splitNode = [&uneven]( TreeType::index_type index ) -> void
+        {
+            const auto firstChild = uneven.split( index, 2 );
+            uneven[firstChild]     = uneven[index] + "0";
+            uneven[firstChild + 1] = uneven[index] + "1";
+        };
+
+        splitNode( uneven.root() );
+        splitNode( uneven.child(uneven.root(), 1) );
+        splitNode( uneven.child(uneven.root(), 0) );
+        splitNode( uneven.child(uneven.child(uneven.root(), 0), 0) );
+
+        CIE_TEST_REQUIRE_NOTHROW( uneven.reorder(TreeType::Ordering::DepthFirst) );
+
+        const std::vector<std::string> reference { "", "0", "1", "00", "01", "000", "001", "10", "11" };
+        CIE_TEST_REQUIRE( uneven.size() == reference.size() );
+        for ( TreeType::index_type i=0; i<uneven.size(); ++i )
+            CIE_TEST_CHECK( uneven[i] == reference[i] );
+
+        for ( TreeType::index_type i=1; i<uneven.size(); ++i )
+            CIE_TEST_CHECK( uneven[uneven.parent(i)] == uneven[i].substr(0, uneven[i].size()-1) );
+    }
+
+    tree.clear();
+    CIE_TEST_CHECK( tree.empty() );
+}
+
+
+} // namespace cie::utils
\ No newline at end of file
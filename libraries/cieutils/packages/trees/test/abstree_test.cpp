@@ -6,6 +6,10 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
 
 namespace cie::utils {
 
@@ -43,4 +47,150 @@ CIE_TEST_CASE( "AbsTree", "[trees]" )
 }
 
 
+CIE_TEST_CASE( "AbsTree - traversals", "[trees]" )
+{
+    CIE_TEST_CASE_INIT( "AbsTree - traversals" )
+
+    // Full binary tree
+    TestTree root(0);
+    const Size depth = 10;
+    const Size numberOfNodes = (1 << (depth+1)) - 1;
+
+    auto split = [depth]( TestTree* p_node ) -> bool
+    {
+        if ( p_node->level() < depth )
+        {
+            p_node->children().push_back( std::make_shared<TestTree>(p_node->level()+1) );
+            p_node->children().push_back( std::make_shared<TestTree>(p_node->level()+1) );
+        }
+        return true;
+    };
+
+    CIE_TEST_REQUIRE( root.visit(split) );
+
+    {
+        CIE_TEST_CASE_INIT( "depth first" )
+
+        std::vector<Size> levels;
+        CIE_TEST_CHECK( root.visit( [&levels]( TestTree* p_node ) { levels.push_back(p_node->level()); return true; } ) );
+
+        CIE_TEST_REQUIRE( levels.size() == numberOfNodes );
+        for ( Size i=0; i<=depth; ++i )
+            CIE_TEST_CHECK( levels[i] == i );
+        CIE_TEST_CHECK( levels[depth+1] == depth );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "breadth first" )
+
+        std::vector<Size> levels;
+        CIE_TEST_CHECK( root.visitBreadthFirst( [&levels]( TestTree* p_node ) { levels.push_back(p_node->level()); return true; } ) );
+
+        CIE_TEST_REQUIRE( levels.size() == numberOfNodes );
+        for ( Size i=1; i<levels.size(); ++i )
+            CIE_TEST_CHECK( levels[i-1] <= levels[i] );
+
+        Size counter = 0;
+        CIE_TEST_CHECK( !root.visitBreadthFirst( [&counter]( TestTree* p_node ) { return p_node->level() < 3 && ++counter; } ) );
+        CIE_TEST_CHECK( counter == 7 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "parallel" )
+
+        mp::ThreadPool pool;
+
+        for ( Size taskDepth : std::vector<Size> {0, 1, 4, depth, depth+1} )
+        {
+            std::atomic<Size> nodeCounter = 0;
+            std::atomic<Size> leafCounter = 0;
+
+            CIE_TEST_CHECK( root.visitParallel(
+                [&nodeCounter, &leafCounter]( TestTree* p_node ) -> bool
+                {
+                    ++nodeCounter;
+                    if ( p_node->isLeaf() )
+                        ++leafCounter;
+                    return true;
+                },
+                pool,
+                taskDepth
+            ) );
+
+            CIE_TEST_CHECK( nodeCounter == numberOfNodes );
+            CIE_TEST_CHECK( leafCounter == (1 << depth) );
+        }
+
+        // Stop early
+        CIE_TEST_CHECK( !root.visitParallel(
+            []( TestTree* p_node ) -> bool { return p_node->level() < depth; },
+            pool
+        ) );
+
+        // Exceptions are forwarded
+        CIE_TEST_CHECK_THROWS( root.visitParallel(
+            []( TestTree* p_node ) -> bool
+            {
+                if ( p_node->isLeaf() )
+                    throw std::runtime_error( "leaf" );
+                return true;
+            },
+            pool
+        ) );
+
+        // Submitted jobs are finished before an exception on the calling thread
+        // is forwarded (the second node on level 1 is visited after the subtrees
+        // of the first one were submitted)
+        std::atomic<Size> levelOneCounter = 0;
+        std::atomic<bool> returned = false;
+        std::atomic<Size> lateCalls = 0;
+
+        CIE_TEST_CHECK_THROWS( root.visitParallel(
+            [&levelOneCounter, &returned, &lateCalls]( TestTree* p_node ) -> bool
+            {
+                if ( returned )
+                    ++lateCalls;
+                if ( p_node->level() == 1 && ++levelOneCounter == 2 )
+                    throw std::runtime_error( "level 1" );
+                std::this_thread::sleep_for( std::chrono::microseconds(10) );
+                return true;
+            },
+            pool,
+            2
+        ) );
+
+        returned = true;
+        std::this_thread::sleep_for( std::chrono::milliseconds(10) );
+        CIE_TEST_CHECK( levelOneCounter == 2 );
+        CIE_TEST_CHECK( lateCalls == 0 );
+    }
+
+    {
+        CIE_TEST_CASE_INIT( "deep tree" )
+
+        // Deep enough to overflow the call stack in a recursive traversal
+        const Size chainLength = 1e6;
+
+        TestTree chain(0);
+        TestTree* p_node = &chain;
+        for ( Size i=0; i<chainLength; ++i )
+        {
+            p_node->children().push_back( std::make_shared<TestTree>(i+1) );
+            p_node = p_node->children().back().get();
+        }
+
+        Size counter = 0;
+        CIE_TEST_CHECK( chain.visit( [&counter]( TestTree* ) { ++counter; return true; } ) );
+        CIE_TEST_CHECK( counter == chainLength + 1 );
+
+        // Release the chain iteratively (the destructors are recursive)
+        while ( !chain.children().empty() )
+        {
+            auto p_child = chain.children().front();
+            chain.children() = std::move( p_child->children() );
+        }
+    }
+}
+
+
 }
\ No newline at end of file